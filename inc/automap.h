@@ -0,0 +1,69 @@
+/* Header guard ------------------------------------------------------------- */
+
+#ifndef AUTOMAP_H
+#define AUTOMAP_H
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "constants.h"
+#include "coords.h"
+#include "level.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+/* Automap image size in pixels, one pixel per tile or per block of tiles */
+#define AUTOMAP_WIDTH  64
+#define AUTOMAP_HEIGHT RENDER_HEIGHT
+#define AUTOMAP_PAGES  ((AUTOMAP_HEIGHT + 7) / 8)
+
+/* Function prototypes ------------------------------------------------------ */
+
+/**
+ * @brief AUTOMAP clear explored map and fit the level into the automap image.
+ * @details Levels larger than the image are downsampled by a power of two, a
+ * pixel being set when any revealed wall of its block of tiles is.
+ *
+ * @param level Level
+ */
+void automap_init(const Level *level);
+
+/**
+ * @brief AUTOMAP mark a wall tile as revealed, e.g. when hit by the raycaster.
+ *
+ * @param x X coordinate
+ * @param y Y coordinate
+ */
+void automap_reveal(int16_t x, int16_t y);
+
+/**
+ * @brief AUTOMAP draw explored map over the raycasting area of the display
+ * buffer.
+ *
+ * NOTE: The image uses the display buffer layout, so it is copied byte by
+ * byte, one byte encoding 8 pixels in a vertical line.
+ *
+ */
+void automap_draw(void);
+
+/**
+ * @brief AUTOMAP draw player marker, a cross with a pixel facing its
+ * direction.
+ *
+ * @param pos Player position
+ * @param dir Player direction
+ */
+void automap_draw_player(const Coords *pos, const Coords *dir);
+
+/**
+ * @brief AUTOMAP draw blinking enemy marker.
+ *
+ * @param pos Enemy position
+ */
+void automap_draw_enemy(const Coords *pos);
+
+#endif /* AUTOMAP_H */
+
+/* -------------------------------------------------------------------------- */
\ No newline at end of file
@@ -8,6 +8,12 @@
 /* Frame rate */
 #define FPS 15
 #define FRAME_TIME (1000.0f / FPS)
+#define FRAME_TIME_US (1000000 / FPS)
+
+/* Animation clock, wraps at a common multiple of every animation period */
+#define ANIM_PERIOD_US      5000000
+#define JOGGING_PERIOD_US   1250000
+#define ENEMY_WALK_FRAME_US 500000
 
 /* Higher values will result in lower horizontal resolution when rasterize and
  * lower process and memory usage. Lower will require more process and memory,
@@ -27,6 +33,11 @@
 /* Faster rendering of vertical lines */
 #define OPTIMIZE_RAYCASTING 1
 
+/* Print per-frame profiling counters to stdout */
+#ifndef PROFILE_ENABLE
+#define PROFILE_ENABLE 0
+#endif
+
 /* Depth buffer for sprites */
 #define ZBUFFER_SIZE ((SCREEN_WIDTH / Z_RES_DIVIDER) + 4)
 
@@ -47,13 +58,12 @@
 #define ROT_SPEED       0.05f
 #define MOV_SPEED       0.1f
 #define GUN_SPEED       2.5f
-#define JOGGING_SPEED   0.005f
 #define ENEMY_SPEED     0.04f
 #define FIREBALL_SPEED  0.2f
-#define FIREBALL_ANGLES 45.0f
+#define FIREBALL_DIRECTIONS 90
 
 #define MAX_ENTITIES           12
-#define MAX_STATIC_ENTITIES    24
+#define MAX_SPAWN_POINTS       256 // Per level, all remembered when done
 #define MAX_ENTITY_DISTANCE    200
 #define MAX_ENEMY_VIEW         90
 #define ITEM_COLLIDER_DIST     6
@@ -62,6 +72,24 @@
 #define ENEMY_MELEE_DIST       9
 #define WALL_COLLIDER_DIST     0.2f
 
+/* Squared distance thresholds, compared against coords_get_distance_sq() */
+#define MAX_ENTITY_DISTANCE_SQ    (MAX_ENTITY_DISTANCE * MAX_ENTITY_DISTANCE)
+#define MAX_ENEMY_VIEW_SQ         (MAX_ENEMY_VIEW * MAX_ENEMY_VIEW)
+#define ITEM_COLLIDER_DIST_SQ     (ITEM_COLLIDER_DIST * ITEM_COLLIDER_DIST)
+#define ENEMY_COLLIDER_DIST_SQ    (ENEMY_COLLIDER_DIST * ENEMY_COLLIDER_DIST)
+#define FIREBALL_COLLIDER_DIST_SQ \
+    (FIREBALL_COLLIDER_DIST * FIREBALL_COLLIDER_DIST)
+#define ENEMY_MELEE_DIST_SQ       (ENEMY_MELEE_DIST * ENEMY_MELEE_DIST)
+
+/* Entities farther than these are updated once every *_PERIOD ticks. Enemies
+ * out of view stand still, so the bands only thin idle entities. */
+#define ENTITY_LOD_MID_DIST      MAX_ENEMY_VIEW
+#define ENTITY_LOD_MID_DIST_SQ   (ENTITY_LOD_MID_DIST * ENTITY_LOD_MID_DIST)
+#define ENTITY_LOD_MID_PERIOD    4
+#define ENTITY_LOD_FAR_DIST      150
+#define ENTITY_LOD_FAR_DIST_SQ   (ENTITY_LOD_FAR_DIST * ENTITY_LOD_FAR_DIST)
+#define ENTITY_LOD_FAR_PERIOD    8
+
 #define ENEMY_MELEE_DAMAGE_EASY      20
 #define ENEMY_MELEE_DAMAGE_NORMAL    30
 #define ENEMY_MELEE_DAMAGE_HARD      40
@@ -89,9 +117,6 @@
 #define AMMO_PICKUP_HARD      9
 #define AMMO_PICKUP_VERY_HARD 5
 
-#define ENEMY_KILL_GOAL1 20
-#define ENEMY_KILL_GOAL2 8
-
 #define SCORE_SECRET_ENDING 200
 
 /* Settings */
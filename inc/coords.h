@@ -23,14 +23,38 @@ typedef struct
 
 /**
  * @brief COORDS compute euclidean distance between two 2D points.
+ *
+ * NOTE: Prefer coords_get_distance_sq() when the result is only compared
+ * against a threshold, it avoids the square root.
  * 
  * @param a Point 1
  * @param b Point 2
- * @return uint8_t Distance
+ * @return uint8_t Distance, saturated to the type range
  */
 static inline uint8_t coords_get_distance(Coords *a, Coords *b)
 {
-    return sqrtf(POW2(a->x - b->x) + POW2(a->y - b->y)) * DISTANCE_MULTIPLIER;
+    float distance = sqrtf(POW2(a->x - b->x) + POW2(a->y - b->y)) *
+                     DISTANCE_MULTIPLIER;
+
+    return MIN(distance, UINT8_MAX);
+}
+
+/**
+ * @brief COORDS compute squared euclidean distance between two 2D points.
+ *
+ * NOTE: Result is scaled by POW2(DISTANCE_MULTIPLIER), so it can be compared
+ * directly against the *_DIST_SQ constants.
+ *
+ * @param a Point 1
+ * @param b Point 2
+ * @return uint16_t Squared distance, saturated to the type range
+ */
+static inline uint16_t coords_get_distance_sq(Coords *a, Coords *b)
+{
+    float distance_sq = (POW2(a->x - b->x) + POW2(a->y - b->y)) *
+                        POW2(DISTANCE_MULTIPLIER);
+
+    return MIN(distance_sq, UINT16_MAX);
 }
 
 #endif /* COORDS_H */
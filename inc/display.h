@@ -217,6 +217,7 @@ void display_draw_int(uint8_t x, uint8_t y, uint8_t num);
 extern uint8_t zbuffer[ZBUFFER_SIZE];
 extern uint8_t display_buf[DISPLAY_BUF_SIZE];
 extern float delta_time;
+extern uint32_t anim_time;
 
 #endif /* DISPLAY_H */
 
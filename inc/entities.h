@@ -12,11 +12,12 @@
 
 /* Definitions -------------------------------------------------------------- */
 
-#define UID_NULL 0
+#define UID_NULL   0
+#define SPAWN_NULL 0xffff
 
 /* Data types --------------------------------------------------------------- */
 
-typedef uint16_t EntityUID;
+typedef uint32_t EntityUID;
 
 typedef enum
 {
@@ -64,21 +65,16 @@ typedef struct
 {
     EntityUID uid;
     Coords pos;
+    Coords velocity;
     uint8_t state;
     uint8_t health;
-    uint8_t distance;
+    uint16_t distance_sq;
     uint8_t timer;
     bool drop_item;
+    bool visible;
+    uint16_t spawn;
 } Entity;
 
-typedef struct
-{
-    EntityUID uid;
-    uint8_t x;
-    uint8_t y;
-    bool active;
-} StaticEntity;
-
 /* Function prototypes ------------------------------------------------------ */
 
 /**
@@ -89,7 +85,7 @@ typedef struct
  * @param y    Y coordinate
  * @return EntityUID Entity UID number
  */
-EntityUID entities_get_uid(EntityType type, uint8_t x, uint8_t y);
+EntityUID entities_get_uid(EntityType type, uint16_t x, uint16_t y);
 
 /**
  * @brief ENTITIES get entity type from UID.
@@ -99,6 +95,25 @@ EntityUID entities_get_uid(EntityType type, uint8_t x, uint8_t y);
  */
 EntityType entities_get_type(EntityUID uid);
 
+/**
+ * @brief ENTITIES quantize a direction vector into one of the
+ * FIREBALL_DIRECTIONS angles with an integer atan2 approximation.
+ *
+ * @param x X component
+ * @param y Y component
+ * @return uint8_t Direction index, counterclockwise from the X axis
+ */
+uint8_t entities_get_direction(int16_t x, int16_t y);
+
+/**
+ * @brief ENTITIES get velocity vector of a given direction.
+ *
+ * @param dir   Direction index
+ * @param speed Speed
+ * @return Coords Velocity vector
+ */
+Coords entities_get_velocity(uint8_t dir, float speed);
+
 /* Function definitions ----------------------------------------------------- */
 
 /**
@@ -108,7 +123,7 @@ EntityType entities_get_type(EntityUID uid);
  * @param y Y coordinate
  * @return Player Player entity instance
  */
-static inline Player entities_create_player(uint8_t x, uint8_t y)
+static inline Player entities_create_player(uint16_t x, uint16_t y)
 {
     return (Player){
         .pos = {x + 0.5f, y + 0.5},
@@ -129,16 +144,19 @@ static inline Player entities_create_player(uint8_t x, uint8_t y)
  * @param y Y coordinate
  * @return Entity Enemy entity instance
  */
-static inline Entity entities_create_enemy(uint8_t x, uint8_t y)
+static inline Entity entities_create_enemy(uint16_t x, uint16_t y)
 {
     return (Entity){
         .uid = entities_get_uid(E_ENEMY, x, y),
         .pos = {x + 0.5f, y + 0.5f},
+        .velocity = {0.0f, 0.0f},
         .state = S_STAND,
         .health = 100,
-        .distance = 0,
+        .distance_sq = 0,
         .timer = 0,
-        .drop_item = true};
+        .drop_item = true,
+        .visible = false,
+        .spawn = SPAWN_NULL};
 }
 
 /**
@@ -148,16 +166,19 @@ static inline Entity entities_create_enemy(uint8_t x, uint8_t y)
  * @param y Y coordinate
  * @return Entity Medkit entity instance
  */
-static inline Entity entities_create_medkit(uint8_t x, uint8_t y)
+static inline Entity entities_create_medkit(uint16_t x, uint16_t y)
 {
     return (Entity){
         .uid = entities_get_uid(E_MEDKIT, x, y),
         .pos = {x + 0.5f, y + 0.5f},
+        .velocity = {0.0f, 0.0f},
         .state = S_STAND,
         .health = 100,
-        .distance = 0,
+        .distance_sq = 0,
         .timer = 0,
-        .drop_item = true};
+        .drop_item = true,
+        .visible = false,
+        .spawn = SPAWN_NULL};
 }
 
 /**
@@ -167,16 +188,19 @@ static inline Entity entities_create_medkit(uint8_t x, uint8_t y)
  * @param y Y coordinate
  * @return Entity Key entity instance
  */
-static inline Entity entities_create_key(uint8_t x, uint8_t y)
+static inline Entity entities_create_key(uint16_t x, uint16_t y)
 {
     return (Entity){
         .uid = entities_get_uid(E_AMMO, x, y),
         .pos = {x + 0.5f, y + 0.5f},
+        .velocity = {0.0f, 0.0f},
         .state = S_STAND,
         .health = 100,
-        .distance = 0,
+        .distance_sq = 0,
         .timer = 0,
-        .drop_item = true};
+        .drop_item = true,
+        .visible = false,
+        .spawn = SPAWN_NULL};
 }
 
 /**
@@ -184,19 +208,22 @@ static inline Entity entities_create_key(uint8_t x, uint8_t y)
  *
  * @param x   X coordinate
  * @param y   Y coordinate
- * @param dir Angle
+ * @param dir Direction index, see entities_get_direction()
  * @return Entity Fireball entity instance
  */
-static inline Entity entities_create_fireball(uint8_t x, uint8_t y, uint8_t dir)
+static inline Entity entities_create_fireball(uint16_t x, uint16_t y, uint8_t dir)
 {
     return (Entity){
-        .uid = entities_get_uid(E_AMMO, x, y),
+        .uid = entities_get_uid(E_FIREBALL, x, y),
         .pos = {x + 0.5f, y + 0.5f},
+        .velocity = entities_get_velocity(dir, FIREBALL_SPEED),
         .state = S_STAND,
-        .health = dir,
-        .distance = 0,
+        .health = 100,
+        .distance_sq = 0,
         .timer = 0,
-        .drop_item = true};
+        .drop_item = true,
+        .visible = false,
+        .spawn = SPAWN_NULL};
 }
 
 #endif /* ENTITIES_H */
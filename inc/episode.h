@@ -0,0 +1,102 @@
+/* Header guard ------------------------------------------------------------- */
+
+#ifndef EPISODE_H
+#define EPISODE_H
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "level.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+/* Episode pack format, compiled by tools/levelc.c from an episode manifest,
+ * multi-byte fields are little endian:
+ *
+ * Header  8 bytes: "DPEP", version, number of levels, reserved (16 bit)
+ * Index   16 bytes per level in play order: offset from the start of the
+ *         pack, size (32 bit), name (4 characters, zero padded), kill goal
+ *         (0 if the level ends at an exit trigger), cutscene shown when the
+ *         level is completed, reserved (16 bit)
+ * Levels  Level binary data of every level, see level.h */
+#define EPISODE_MAGIC       "DPEP"
+#define EPISODE_VERSION     1
+#define EPISODE_HEADER_SIZE 8
+#define EPISODE_INDEX_SIZE  16
+#define EPISODE_NAME_SIZE   4
+
+/* External episode packs, mapped in place of the built-in ones when found */
+#define EPISODE_PATH_FORMAT "levels/%s.pak"
+
+/* Data types --------------------------------------------------------------- */
+
+typedef enum
+{
+    CUTSCENE_INTRO,
+    CUTSCENE_MID,
+    CUTSCENE_END
+} EpisodeCutscene;
+
+typedef struct
+{
+    uint32_t offset;
+    uint32_t size;
+    uint8_t kill_goal;
+    EpisodeCutscene cutscene;
+} EpisodeLevel;
+
+typedef struct
+{
+    const uint8_t *data;
+    uint32_t size;
+    uint8_t num_levels;
+} Episode;
+
+/* Function prototypes ------------------------------------------------------ */
+
+/**
+ * @brief EPISODE load episode pack index from binary data, either mapped from
+ * a file or stored in flash.
+ * @details Only the header and the index are checked, levels are validated
+ * when loaded.
+ *
+ * NOTE: Data is referenced and not copied, it must outlive the episode and
+ * its levels.
+ *
+ * @param episode Episode to be loaded
+ * @param data    Episode pack binary data
+ * @param size    Size of data in bytes
+ * @return bool Episode pack index is valid
+ */
+bool episode_load(Episode *episode, const uint8_t *data, uint32_t size);
+
+/**
+ * @brief EPISODE get level metadata from the episode index.
+ *
+ * @param episode Episode
+ * @param i       Level index
+ * @return EpisodeLevel Level metadata
+ */
+EpisodeLevel episode_get_level(const Episode *episode, uint8_t i);
+
+/**
+ * @brief EPISODE load a single level of the episode.
+ *
+ * @param episode Episode
+ * @param i       Level index
+ * @param level   Level to be loaded
+ * @return bool Level data is valid
+ */
+bool episode_load_level(const Episode *episode, uint8_t i, Level *level);
+
+/* Built-in episodes -------------------------------------------------------- */
+
+#ifndef LEVEL_NO_DATA
+#include "level_data.h"
+#endif
+
+#endif /* EPISODE_H */
+
+/* -------------------------------------------------------------------------- */
\ No newline at end of file
@@ -18,7 +18,8 @@ typedef enum
     FIRE  = 0b00010000,
     JUMP  = 0b00100000,
     HOME  = 0b01000000,
-    EXIT  = 0b10000000
+    EXIT  = 0b10000000,
+    MAP   = 0b100000000
 } Buttons;
 
 /* Function prototypes ------------------------------------------------------ */
@@ -91,6 +92,13 @@ bool input_home(void);
  */
 bool input_exit(void);
 
+/**
+ * @brief INPUT check if map button has been pressed.
+ * 
+ * @return bool button is pressed
+ */
+bool input_map(void);
+
 /* Global variables --------------------------------------------------------- */
 
 extern volatile uint16_t input_button;
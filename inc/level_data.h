@@ -0,0 +1,628 @@
+/* Generated by tools/levelc.c from levels/, do not edit */
+
+/* Header guard ------------------------------------------------------------- */
+
+#ifndef LEVEL_DATA_H
+#define LEVEL_DATA_H
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+
+static const uint8_t episode_e1[] = {
+    /* Episode header */
+    0x44, 0x50, 0x45, 0x50, 0x01, 0x02, 0x00, 0x00,
+    /* Episode index */
+    0x28, 0x00, 0x00, 0x00, 0xF6, 0x0D, 0x00, 0x00, 0x65, 0x31, 0x6D, 0x31,
+    0x14, 0x01, 0x00, 0x00, 0x1E, 0x0E, 0x00, 0x00, 0x82, 0x0D, 0x00, 0x00,
+    0x65, 0x31, 0x6D, 0x32, 0x00, 0x02, 0x00, 0x00,
+    /* Level e1m1 header */
+    0x44, 0x50, 0x4C, 0x56, 0x04, 0x03, 0x40, 0x00, 0x39, 0x00, 0x2B, 0x00,
+    0x02, 0x00, 0x06, 0x00,
+    /* Map */
+    0x00, 0x00, 0x00, 0x00, 0x26, 0x00, 0x00, 0x00, 0x69, 0x00, 0x00, 0x00,
+    0xCB, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x71, 0x01, 0x00, 0x00,
+    0x9B, 0x01, 0x00, 0x00, 0xF6, 0x01, 0x00, 0x00, 0x59, 0x02, 0x00, 0x00,
+    0xD0, 0x02, 0x00, 0x00, 0x05, 0x03, 0x00, 0x00, 0x54, 0x03, 0x00, 0x00,
+    0x5E, 0x03, 0x00, 0x00, 0x95, 0x03, 0x00, 0x00, 0xCA, 0x03, 0x00, 0x00,
+    0xF4, 0x03, 0x00, 0x00, 0x02, 0x04, 0x00, 0x00, 0xBE, 0xFF, 0x00, 0x00,
+    0x86, 0xFF, 0x00, 0x00, 0x8D, 0xFF, 0x01, 0xF0, 0x00, 0x84, 0xFF, 0x02,
+    0xF0, 0x00, 0x0F, 0x85, 0xFF, 0x01, 0xF0, 0x0F, 0x87, 0xFF, 0x00, 0xF0,
+    0x86, 0x00, 0x02, 0xF0, 0x00, 0x02, 0x83, 0x00, 0x00, 0x20, 0x8D, 0xFF,
+    0x01, 0x00, 0x00, 0x85, 0xFF, 0x01, 0x00, 0x00, 0x85, 0xFF, 0x01, 0x00,
+    0x02, 0x8D, 0xFF, 0x01, 0x00, 0x00, 0x85, 0xFF, 0x01, 0x00, 0x00, 0x85,
+    0xFF, 0x01, 0x00, 0x00, 0x8D, 0xFF, 0x82, 0x00, 0x84, 0xFF, 0x03, 0x01,
+    0x00, 0x00, 0xF0, 0x83, 0xFF, 0x82, 0x00, 0x01, 0xF0, 0x0F, 0x8C, 0xFF,
+    0x04, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0x82, 0xFF, 0x07, 0x00, 0x50, 0x00,
+    0x20, 0x00, 0x7F, 0xFF, 0xFF, 0x87, 0xFF, 0x83, 0x00, 0x00, 0x0F, 0x82,
+    0xFF, 0x82, 0x00, 0x01, 0x29, 0x0F, 0x82, 0xFF, 0x83, 0x00, 0x00, 0x0F,
+    0x82, 0xFF, 0x01, 0xF0, 0x02, 0x85, 0xFF, 0x04, 0xF0, 0x00, 0xF0, 0x00,
+    0x0F, 0x82, 0xFF, 0x04, 0x40, 0x00, 0x40, 0x00, 0x0F, 0x82, 0xFF, 0x04,
+    0xF0, 0x00, 0xF0, 0x00, 0x0F, 0x82, 0xFF, 0x01, 0xF0, 0x00, 0x85, 0xFF,
+    0x04, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0x82, 0xFF, 0x04, 0x40, 0x00, 0x40,
+    0x00, 0x0F, 0x82, 0xFF, 0x04, 0xF0, 0x00, 0xF0, 0x00, 0x0F, 0x83, 0xFF,
+    0x00, 0x5F, 0x85, 0xFF, 0x01, 0xF0, 0x00, 0x85, 0xFF, 0x01, 0xF0, 0x00,
+    0x85, 0xFF, 0x01, 0xF0, 0x00, 0x85, 0xFF, 0xC1, 0xFF, 0x02, 0x02, 0x02,
+    0x0F, 0x84, 0xFF, 0x02, 0x00, 0x00, 0x0F, 0x84, 0xFF, 0x02, 0x00, 0x80,
+    0x0F, 0x84, 0xFF, 0x02, 0x00, 0x00, 0x0F, 0x84, 0xFF, 0x02, 0x00, 0x90,
+    0x0F, 0x85, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0xAF, 0x85, 0xFF, 0x83,
+    0x0F, 0x01, 0xFF, 0xFF, 0x00, 0xF0, 0x86, 0x00, 0x39, 0xF0, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x40,
+    0x80, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF,
+    0xFF, 0xF2, 0x02, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x82, 0xFF, 0x05, 0x5F, 0xFF,
+    0xFF, 0xF0, 0x00, 0xFF, 0x83, 0x00, 0x03, 0x0F, 0xF0, 0x00, 0xFF, 0x83,
+    0x00, 0x0B, 0x0F, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x02, 0x00, 0x0F, 0xF0,
+    0x00, 0x0F, 0x83, 0x00, 0x0B, 0x0F, 0xF0, 0x00, 0x05, 0x00, 0x00, 0x90,
+    0x00, 0x0F, 0xF0, 0x00, 0x0F, 0x83, 0x00, 0x08, 0x0F, 0xF0, 0x00, 0xFF,
+    0x00, 0x02, 0x00, 0x00, 0x0F, 0x04, 0x0F, 0xF0, 0x00, 0x00, 0x0F, 0xCF,
+    0xFF, 0x02, 0xF0, 0x00, 0x00, 0x84, 0xFF, 0x02, 0xF0, 0x00, 0x00, 0x84,
+    0xFF, 0x02, 0xF0, 0x00, 0x00, 0x84, 0xFF, 0x02, 0xF0, 0x00, 0x00, 0x84,
+    0xFF, 0x02, 0xF0, 0x00, 0x20, 0x84, 0xFF, 0x02, 0xF0, 0x00, 0x00, 0x01,
+    0xF0, 0x00, 0x84, 0xFF, 0x02, 0xF0, 0xF0, 0x00, 0x84, 0xFF, 0x02, 0xF0,
+    0xF0, 0x00, 0x84, 0xFF, 0x02, 0xF0, 0xF0, 0x00, 0x84, 0xFF, 0x02, 0xF0,
+    0xF0, 0x00, 0x84, 0xFF, 0x02, 0xF0, 0xF0, 0x20, 0x84, 0xFF, 0x02, 0xF0,
+    0xF0, 0x00, 0x84, 0xFF, 0x02, 0xF0, 0xF0, 0x00, 0x84, 0xFF, 0x02, 0xF0,
+    0xFF, 0x4F, 0x84, 0xFF, 0x03, 0xF0, 0x00, 0x00, 0x0F, 0x83, 0xFF, 0x00,
+    0xF0, 0x84, 0x00, 0x02, 0xFF, 0xFF, 0xF0, 0x84, 0x00, 0x01, 0xFF, 0xFF,
+    0x85, 0x00, 0x00, 0x0F, 0x86, 0x00, 0x00, 0x04, 0x84, 0x00, 0x02, 0x20,
+    0x00, 0x0F, 0x86, 0x00, 0x82, 0xFF, 0x01, 0x00, 0xF0, 0x83, 0x00, 0x0B,
+    0xFF, 0xFF, 0x00, 0x40, 0x00, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0x00, 0xF0,
+    0x83, 0x00, 0x0A, 0xFF, 0xFF, 0x0F, 0xFF, 0x0F, 0x0F, 0x8F, 0x0F, 0xFF,
+    0xFF, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF,
+    0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x02, 0x0F, 0xFF, 0xFF,
+    0x83, 0x00, 0x0B, 0xFF, 0x0F, 0xFF, 0xFF, 0x00, 0x00, 0x08, 0x00, 0xFF,
+    0x00, 0xFF, 0xFF, 0x83, 0x00, 0x03, 0xFF, 0x00, 0x00, 0x0F, 0x83, 0x00,
+    0x0B, 0xFF, 0x20, 0x00, 0x04, 0x00, 0x00, 0x20, 0x00, 0xFF, 0x00, 0x00,
+    0x0F, 0x83, 0x00, 0x83, 0xFF, 0x83, 0x00, 0x00, 0xFF, 0x02, 0xF0, 0x00,
+    0xFF, 0x83, 0x00, 0x03, 0x0F, 0xF0, 0x20, 0xFF, 0x83, 0x00, 0x02, 0x0F,
+    0xF0, 0x00, 0x82, 0xFF, 0x20, 0x4F, 0xFF, 0xFF, 0xF0, 0x00, 0xF0, 0x00,
+    0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0x40, 0x00, 0xF0, 0x00, 0xFF, 0xFF,
+    0xF0, 0x00, 0xF0, 0x00, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
+    0xF0, 0x00, 0x82, 0xFF, 0x10, 0x4F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF,
+    0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0xF0, 0x90, 0x82, 0xFF,
+    0x05, 0x4F, 0xFF, 0xFF, 0xF0, 0x00, 0xFF, 0x83, 0x00, 0x00, 0x0F, 0x82,
+    0xFF, 0x82, 0x00, 0x01, 0x20, 0x0F, 0x82, 0xFF, 0x83, 0x00, 0x00, 0x0F,
+    0x82, 0xFF, 0x04, 0x00, 0x00, 0x20, 0x00, 0x04, 0x82, 0xFF, 0x83, 0x00,
+    0x00, 0x0F, 0x82, 0xFF, 0x83, 0x00, 0x00, 0x0F, 0x84, 0xFF, 0x02, 0xF0,
+    0x00, 0x00, 0xA4, 0xFF, 0x01, 0xF0, 0x0F, 0x85, 0xFF, 0x01, 0xF0, 0x0F,
+    0x85, 0xFF, 0x01, 0xF0, 0x0F, 0x85, 0xFF, 0x02, 0xF0, 0x00, 0xF2, 0x97,
+    0xFF, 0x82, 0x00, 0x00, 0x0F, 0x83, 0xFF, 0x03, 0x00, 0x02, 0x00, 0x0F,
+    0x83, 0xFF, 0x82, 0x00, 0x00, 0x2F, 0x84, 0xFF, 0x01, 0x00, 0x0F, 0x84,
+    0xFF, 0x84, 0x00, 0x82, 0xFF, 0x02, 0x00, 0x00, 0x0F, 0x85, 0xFF, 0x00,
+    0x5F, 0x85, 0xFF, 0x01, 0xF0, 0x00, 0x85, 0xFF, 0x01, 0xF0, 0x00, 0x85,
+    0xFF, 0x01, 0xF0, 0x00, 0x85, 0xFF, 0x01, 0xF0, 0x00, 0x85, 0xFF, 0x01,
+    0xF0, 0x00, 0x85, 0xFF, 0x02, 0x00, 0x00, 0x09, 0x84, 0xFF, 0x01, 0xF0,
+    0x00, 0x85, 0xFF, 0x01, 0xF0, 0x00, 0x85, 0xFF, 0x01, 0xF0, 0x00, 0x85,
+    0xFF, 0x01, 0xF0, 0x00, 0x85, 0xFF, 0x01, 0xF0, 0x00, 0x85, 0xFF, 0x01,
+    0xF0, 0x00, 0x86, 0xFF, 0x00, 0x4F, 0x85, 0xFF, 0x82, 0xFF, 0x83, 0x00,
+    0x83, 0xFF, 0x83, 0x00, 0xF0, 0xFF, 0x82, 0xFF, 0x83, 0x00, 0x00, 0x0F,
+    0x82, 0xFF, 0x00, 0x0F, 0x83, 0xFF, 0x03, 0xF0, 0x00, 0xFF, 0xDF, 0x83,
+    0xFF, 0x03, 0xF0, 0x00, 0xFF, 0x0F, 0x83, 0xFF, 0x00, 0xF0, 0x86, 0x00,
+    0x09, 0xF0, 0x00, 0xFF, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x90, 0x84,
+    0xFF, 0x02, 0x00, 0xF0, 0x00, 0x84, 0xFF, 0x00, 0x80, 0x87, 0xFF, 0xB7,
+    0x00, 0x02, 0xFF, 0x00, 0x0F, 0x82, 0xFF, 0x04, 0xF0, 0x00, 0xFF, 0x00,
+    0x0F, 0x82, 0xFF, 0x02, 0xF0, 0x00, 0xFF, 0x84, 0x00, 0x02, 0xF0, 0x00,
+    0xFF, 0x84, 0x00, 0x02, 0x50, 0x0C, 0x0F, 0x84, 0x00, 0x02, 0xF0, 0x00,
+    0x0F, 0x84, 0xFF, 0x00, 0xF0, 0x82, 0x00, 0x83, 0xFF, 0x03, 0xF0, 0x00,
+    0x80, 0x80, 0x8D, 0xFF, 0xB7, 0x00, 0x83, 0x00, 0x83, 0xFF, 0x83, 0x00,
+    0x83, 0xFF, 0x83, 0x00, 0x0B, 0xF0, 0x00, 0xFF, 0xFF, 0x02, 0x20, 0xC0,
+    0x00, 0x00, 0x80, 0xFF, 0xFF, 0x83, 0x00, 0x07, 0xF0, 0x00, 0xFF, 0xFF,
+    0x00, 0x00, 0x02, 0x00, 0x83, 0xFF, 0x83, 0x00, 0x93, 0xFF, 0xB7, 0x00,
+    0xB5, 0xFF, 0x01, 0xF0, 0x0F, 0x85, 0xFF, 0x01, 0xF0, 0x0F, 0x87, 0xFF,
+    0xB7, 0x00,
+    /* Spawns */
+    0x02, 0x00, 0x26, 0x00, 0x02, 0x00, 0x09, 0x00, 0x27, 0x00, 0x02, 0x00,
+    0x02, 0x00, 0x1F, 0x00, 0x03, 0x00, 0x02, 0x00, 0x23, 0x00, 0x04, 0x00,
+    0x02, 0x00, 0x35, 0x00, 0x08, 0x00, 0x02, 0x00, 0x37, 0x00, 0x08, 0x00,
+    0x01, 0x00, 0x1D, 0x00, 0x0A, 0x00, 0x08, 0x00, 0x36, 0x00, 0x0A, 0x00,
+    0x09, 0x00, 0x36, 0x00, 0x0C, 0x00, 0x02, 0x00, 0x05, 0x00, 0x0F, 0x00,
+    0x02, 0x00, 0x0E, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x16, 0x00, 0x0F, 0x00,
+    0x02, 0x00, 0x37, 0x00, 0x11, 0x00, 0x09, 0x00, 0x3A, 0x00, 0x11, 0x00,
+    0x08, 0x00, 0x38, 0x00, 0x13, 0x00, 0x08, 0x00, 0x06, 0x00, 0x14, 0x00,
+    0x02, 0x00, 0x22, 0x00, 0x15, 0x00, 0x02, 0x00, 0x01, 0x00, 0x16, 0x00,
+    0x02, 0x00, 0x03, 0x00, 0x16, 0x00, 0x08, 0x00, 0x3B, 0x00, 0x1A, 0x00,
+    0x02, 0x00, 0x0B, 0x00, 0x1B, 0x00, 0x09, 0x00, 0x0A, 0x00, 0x1D, 0x00,
+    0x02, 0x00, 0x30, 0x00, 0x1D, 0x00, 0x02, 0x00, 0x3A, 0x00, 0x1D, 0x00,
+    0x02, 0x00, 0x1E, 0x00, 0x1E, 0x00, 0x02, 0x00, 0x26, 0x00, 0x1E, 0x00,
+    0x02, 0x00, 0x09, 0x00, 0x1F, 0x00, 0x02, 0x00, 0x02, 0x00, 0x21, 0x00,
+    0x02, 0x00, 0x1F, 0x00, 0x28, 0x00, 0x09, 0x00, 0x25, 0x00, 0x28, 0x00,
+    0x09, 0x00, 0x02, 0x00, 0x29, 0x00, 0x02, 0x00, 0x0C, 0x00, 0x2B, 0x00,
+    0x02, 0x00, 0x0A, 0x00, 0x2D, 0x00, 0x02, 0x00, 0x13, 0x00, 0x2D, 0x00,
+    0x02, 0x00, 0x16, 0x00, 0x2E, 0x00, 0x02, 0x00, 0x21, 0x00, 0x33, 0x00,
+    0x02, 0x00, 0x22, 0x00, 0x33, 0x00, 0x08, 0x00, 0x2A, 0x00, 0x33, 0x00,
+    0x02, 0x00, 0x25, 0x00, 0x35, 0x00, 0x09, 0x00, 0x02, 0x00, 0x36, 0x00,
+    0x08, 0x00, 0x0E, 0x00, 0x37, 0x00, 0x08, 0x00, 0x10, 0x00, 0x37, 0x00,
+    0x08, 0x00, 0x12, 0x00, 0x37, 0x00,
+    /* Triggers */
+    0x02, 0x00, 0x36, 0x00, 0x02, 0x00, 0x36, 0x00, 0x00, 0x02, 0x01, 0x00,
+    0x33, 0x00, 0x00, 0x00, 0x02, 0x00, 0x36, 0x00, 0x02, 0x00, 0x36, 0x00,
+    0x00, 0x02, 0x03, 0x00, 0x33, 0x00, 0x00, 0x00,
+    /* Solid */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x88, 0x7F, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xF0,
+    0x88, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x8F, 0xFF, 0xF0, 0x7F,
+    0xFF, 0xFF, 0xFF, 0xF0, 0x88, 0x7F, 0xF0, 0x7F, 0xFF, 0xF8, 0x3F, 0xF0,
+    0x00, 0x7F, 0xF0, 0x7F, 0xFF, 0xE1, 0x2F, 0xF0, 0x88, 0x7F, 0xF0, 0x7F,
+    0xFF, 0xF9, 0x27, 0xFF, 0xDF, 0xFF, 0xF0, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFD, 0xFF, 0x80, 0x00, 0x60, 0x7F, 0x8F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x00, 0x00, 0x1F, 0x8F, 0xFF, 0xF5, 0x5F, 0x80, 0x00, 0x60, 0x7F,
+    0x8F, 0xFE, 0x20, 0x0F, 0x8F, 0x8F, 0xFF, 0xFF, 0x8F, 0xFE, 0x00, 0x0F,
+    0x8F, 0x8F, 0xFF, 0xFF, 0x8F, 0xFE, 0x20, 0x0F, 0x88, 0x8F, 0xFF, 0xFF,
+    0x8F, 0xFE, 0x75, 0x5F, 0x80, 0x8F, 0xFF, 0xFF, 0x8F, 0xFE, 0x7F, 0xFF,
+    0x88, 0x8F, 0xFF, 0xFF, 0x8F, 0xFE, 0x7F, 0xFF, 0x8F, 0x8F, 0xFF, 0xFF,
+    0x8F, 0xFE, 0x7F, 0xFF, 0x8F, 0x8F, 0xFF, 0xFF, 0x8F, 0xFE, 0x7F, 0xFF,
+    0x8F, 0xDF, 0xFF, 0xFF, 0xDF, 0xFE, 0x7F, 0xFF, 0x8C, 0x01, 0xFF, 0xFF,
+    0x07, 0xFE, 0x7C, 0x03, 0x8C, 0x01, 0xFF, 0xE0, 0x00, 0x3E, 0x7C, 0x03,
+    0x8C, 0x01, 0xFF, 0xE0, 0x00, 0x3C, 0x3C, 0x03, 0x84, 0x01, 0xFF, 0xE0,
+    0x00, 0x10, 0x04, 0x03, 0x80, 0x01, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x03,
+    0x84, 0x01, 0xFF, 0xE0, 0x00, 0x10, 0x04, 0x03, 0x8C, 0x01, 0xFF, 0xE0,
+    0x00, 0x3F, 0xFC, 0x03, 0x8C, 0x01, 0xFF, 0xE0, 0x00, 0x3F, 0xFC, 0x03,
+    0x8C, 0x01, 0xFF, 0xFF, 0x07, 0xFF, 0xFC, 0x03, 0x8F, 0xDF, 0xFF, 0xFF,
+    0xDF, 0xFF, 0xFF, 0xFF, 0x88, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0x80, 0x8F, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0x88, 0x8F, 0xFF, 0xE7,
+    0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0xFF, 0xE7, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xDF, 0x8F, 0xFF, 0xE7, 0x8F, 0xFF, 0xFF, 0xFF, 0x8F, 0x8F, 0xFF, 0xE2,
+    0x03, 0xFF, 0xFF, 0xFF, 0x8F, 0xDF, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0x8C, 0x01, 0xFF, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xFF, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0x01, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x00, 0x01, 0xFF, 0x8F, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0x01, 0xFF,
+    0x8F, 0xFF, 0xFF, 0xFF, 0xFC, 0x01, 0xC7, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF,
+    0xFC, 0x01, 0xC7, 0xF8, 0x00, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xC7, 0xF8,
+    0x00, 0xFF, 0xFF, 0xFF, 0x8F, 0xFF, 0xC0, 0x08, 0x00, 0x8F, 0xFF, 0xFF,
+    0x8D, 0xFF, 0xC0, 0x01, 0x08, 0x0F, 0xFF, 0xFF, 0x80, 0x00, 0x40, 0x08,
+    0x00, 0x8F, 0xFF, 0xFF, 0x8C, 0x1F, 0x7F, 0xF8, 0x00, 0xFF, 0xFF, 0xFF,
+    0x8F, 0xFC, 0x0F, 0xF8, 0x00, 0xFF, 0xFF, 0xF9, 0x8F, 0xFC, 0x0F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* Trigger index */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+    0x01, 0x00,
+    /* PVS */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF0, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x01, 0xE3,
+    0x83, 0x04, 0x00, 0x00, 0x00, 0x03, 0xC6, 0x04, 0x08, 0x00, 0x00, 0x00,
+    0x07, 0x8C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xF0, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0xE3, 0x82, 0x04, 0x00, 0x00, 0x01, 0x83, 0xC2, 0x04,
+    0x08, 0x00, 0x00, 0x00, 0x07, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x41, 0xC1, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0xF0, 0x80, 0x00, 0x00, 0x00, 0x70, 0xF1, 0xE1, 0x02, 0x04, 0x00, 0x00,
+    0xC0, 0x83, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF1, 0xE3, 0x04, 0x00, 0x00, 0x00, 0x01, 0xF3, 0xE5,
+    0x08, 0x00, 0x00, 0x00, 0x03, 0xF7, 0xE2, 0x04, 0x00, 0x00, 0x00, 0xE7,
+    0xFF, 0xE4, 0x08, 0x00, 0x00, 0x00, 0xC7, 0xEF, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x87, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x30, 0xE0, 0x81,
+    0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xC7, 0x88,
+    0x00, 0x00, 0x00, 0x00, 0xC1, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0xF1, 0x82, 0x06, 0x00, 0x00,
+    0x00, 0xF9, 0xF3, 0x04, 0x08, 0x00, 0x00, 0x01, 0xFB, 0xE1, 0x03, 0x0E,
+    0x00, 0x00, 0x03, 0xFF, 0xC2, 0x04, 0x08, 0x00, 0x00, 0x03, 0xF7, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0xC3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x20, 0x40, 0x81, 0x03, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18,
+    0xF1, 0x83, 0x06, 0x00, 0x00, 0x00, 0x31, 0xE3, 0x06, 0x0C, 0x00, 0x00,
+    0x00, 0x63, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x60, 0xC1,
+    0x03, 0x04, 0x00, 0x00, 0x40, 0xC1, 0x82, 0x04, 0x08, 0x00, 0x00, 0x70,
+    0x60, 0x83, 0x87, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0x83, 0x8F, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x60, 0xC1, 0x83, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x83,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x18, 0x30, 0x60, 0x81, 0xE2, 0xC6, 0x00, 0x00, 0x00, 0x20, 0xE3, 0xC7,
+    0x82, 0x00, 0x18, 0x30, 0x41, 0xC7, 0x8F, 0x04, 0x00, 0x00, 0x40, 0x83,
+    0x8F, 0x1E, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xE3, 0xC0,
+    0x00, 0x00, 0x00, 0x21, 0xF3, 0xE7, 0xC2, 0x00, 0x10, 0x20, 0x43, 0xE7,
+    0xEF, 0x84, 0x00, 0x00, 0x40, 0x87, 0xCF, 0xFF, 0x08, 0x00, 0x00, 0x00,
+    0x07, 0x8F, 0xDE, 0x10, 0x00, 0x00, 0x30, 0x60, 0xCF, 0xF8, 0x40, 0x00,
+    0x00, 0x60, 0xC1, 0x8F, 0xF0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xC3,
+    0x80, 0x00, 0x00, 0x00, 0x01, 0xCF, 0x87, 0x00, 0x00, 0x00, 0x00, 0x03,
+    0x8F, 0x0E, 0x00, 0x00, 0x18, 0x30, 0x78, 0xF1, 0x63, 0x04, 0x00, 0x28,
+    0x50, 0xF1, 0xE3, 0xC5, 0x08, 0x00, 0x18, 0x21, 0xE3, 0xC7, 0x82, 0x04,
+    0x00, 0x20, 0x43, 0xC7, 0x87, 0x04, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x78, 0xF1, 0xE0, 0x00, 0x00, 0x08, 0x10, 0xF9, 0xF3, 0xE1, 0x00, 0x00,
+    0x10, 0x21, 0xFB, 0xF7, 0xC2, 0x06, 0x00, 0x20, 0x43, 0xFF, 0xFF, 0x84,
+    0x08, 0x00, 0x00, 0x83, 0xF7, 0xFF, 0x00, 0x00, 0x00, 0x18, 0x33, 0xEF,
+    0xFE, 0x00, 0x00, 0x00, 0x30, 0x63, 0xFF, 0xF8, 0x60, 0x00, 0x00, 0x00,
+    0x01, 0xF7, 0xE1, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xE7, 0xC3, 0x80, 0x00,
+    0x00, 0x00, 0x03, 0xC7, 0x87, 0x00, 0x00, 0x00, 0x18, 0x3C, 0x70, 0x81,
+    0x82, 0x00, 0x00, 0x08, 0x38, 0x70, 0xE3, 0x00, 0x00, 0x00, 0x10, 0xF1,
+    0xE1, 0xC1, 0x02, 0x06, 0x00, 0x21, 0xE3, 0xC3, 0x82, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x04, 0x3C, 0x78, 0xF0, 0x00, 0x00, 0x00, 0x08, 0x7C, 0xF9,
+    0xF0, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFB, 0xE1, 0x03, 0x04, 0x00, 0x21,
+    0xFF, 0xFF, 0xC2, 0x00, 0x00, 0x00, 0x41, 0xE3, 0xE7, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x70, 0xE0, 0x00, 0x00, 0x00, 0x01, 0xF1,
+    0xE1, 0xC0, 0x00, 0x00, 0x00, 0x01, 0xE3, 0xC3, 0x80, 0x00, 0x00, 0x00,
+    0x10, 0x30, 0x60, 0xC1, 0x00, 0x00, 0x00, 0x20, 0x40, 0xC1, 0x82, 0x00,
+    0x00, 0x00, 0x38, 0x70, 0x60, 0x81, 0x87, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0x83, 0x00, 0x00, 0x00, 0x3C, 0x70, 0x60, 0x83,
+    0x82, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x20, 0x60, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE1, 0xE3, 0x80, 0x00, 0x18, 0x20, 0x41, 0xC3, 0xE7, 0xC0,
+    0x00, 0x00, 0x00, 0x83, 0x87, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xE0, 0x00, 0x00, 0x00,
+    0x18, 0x20, 0x41, 0xC1, 0x03, 0x0E, 0x00, 0x20, 0x40, 0x83, 0x82, 0x04,
+    0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x70, 0xF1, 0xC0, 0x00, 0x00, 0x10, 0x20,
+    0xE1, 0xF3, 0xA0, 0x00, 0x00, 0x20, 0x41, 0xC3, 0xE7, 0xC0, 0x00, 0x00,
+    0x00, 0x03, 0x87, 0xCF, 0x83, 0x80, 0x00, 0x00, 0x03, 0x07, 0x8B, 0x06,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x60, 0x87, 0xCF, 0x80, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x81, 0xE0, 0x00, 0x00, 0x08, 0x38, 0x78, 0xE3, 0xE0,
+    0x00, 0x00, 0x10, 0x70, 0xF9, 0xC0, 0x00, 0x00, 0x00, 0x20, 0xE1, 0xE3,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xE0, 0xF1, 0xE0, 0x00, 0x00, 0x01,
+    0x83, 0xC1, 0xF3, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x13, 0xF7, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x27, 0xFF, 0xE0, 0x00, 0x00, 0x10, 0x30, 0x47, 0xEF,
+    0xC0, 0x00, 0x00, 0x00, 0x40, 0x87, 0xCF, 0x80, 0x00, 0x00, 0x00, 0x01,
+    0x07, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xF0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC1, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x07, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x32, 0x7F, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x60, 0xF9, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x89,
+    0xFB, 0x80, 0x00, 0x00, 0x00, 0x08, 0x13, 0xF8, 0xE0, 0x00, 0x00, 0x00,
+    0x18, 0x23, 0xF1, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x43, 0xE3, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x83, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* Level e1m2 header */
+    0x44, 0x50, 0x4C, 0x56, 0x04, 0x03, 0x40, 0x00, 0x39, 0x00, 0x19, 0x00,
+    0x0C, 0x00, 0x00, 0x00,
+    /* Map */
+    0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x49, 0x00, 0x00, 0x00,
+    0xA8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x02, 0x01, 0x00, 0x00,
+    0x54, 0x01, 0x00, 0x00, 0xBE, 0x01, 0x00, 0x00, 0x2E, 0x02, 0x00, 0x00,
+    0x6D, 0x02, 0x00, 0x00, 0x87, 0x02, 0x00, 0x00, 0xC7, 0x02, 0x00, 0x00,
+    0xE7, 0x02, 0x00, 0x00, 0x14, 0x03, 0x00, 0x00, 0x2E, 0x03, 0x00, 0x00,
+    0x32, 0x03, 0x00, 0x00, 0x36, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0x9B, 0xFF,
+    0x00, 0xF0, 0x82, 0x00, 0x83, 0xFF, 0x00, 0xF0, 0x86, 0xFF, 0x03, 0xF0,
+    0xF0, 0x00, 0x00, 0x83, 0xFF, 0x01, 0xF0, 0xF0, 0x85, 0xFF, 0x06, 0xF8,
+    0x00, 0xF0, 0x00, 0xFF, 0x08, 0x80, 0x85, 0xFF, 0x82, 0x00, 0x00, 0xB0,
+    0x82, 0x00, 0x02, 0xFF, 0x09, 0x90, 0x89, 0xFF, 0x02, 0xF0, 0x00, 0x00,
+    0x84, 0xFF, 0x02, 0xF0, 0xFF, 0xF0, 0x83, 0xFF, 0x83, 0xF0, 0x83, 0xFF,
+    0x83, 0xF0, 0x83, 0xFF, 0x03, 0xF9, 0x00, 0xF0, 0xF0, 0x97, 0xFF, 0x82,
+    0x00, 0x00, 0xF0, 0x82, 0x00, 0x09, 0xF1, 0xFF, 0xF0, 0xF2, 0xF0, 0xF0,
+    0xFF, 0xF0, 0xFF, 0x00, 0x89, 0xF0, 0x00, 0xFF, 0x83, 0xF0, 0x04, 0x00,
+    0xF0, 0xF0, 0x00, 0x00, 0x82, 0xF0, 0x0A, 0xFF, 0xF0, 0xF0, 0xFF, 0xFF,
+    0xF0, 0xF0, 0xFF, 0x00, 0xF0, 0xF0, 0x82, 0x00, 0x01, 0xF0, 0x00, 0x82,
+    0xF0, 0x04, 0xFF, 0xFF, 0xF0, 0xFF, 0xFF, 0x82, 0xF0, 0x04, 0xF9, 0x00,
+    0xF0, 0xF0, 0x00, 0x82, 0xF0, 0x00, 0xFF, 0x84, 0xF0, 0x08, 0x00, 0xF0,
+    0x00, 0xF0, 0xF0, 0xF2, 0xF0, 0xFF, 0xFF, 0x83, 0xF0, 0x04, 0xFF, 0xF0,
+    0xF0, 0x00, 0x00, 0x82, 0xF0, 0x01, 0x00, 0x00, 0x97, 0xFF, 0x85, 0x00,
+    0x00, 0x0F, 0x83, 0xFF, 0x05, 0x0F, 0xFF, 0xFF, 0x0F, 0xFF, 0xF0, 0x83,
+    0x00, 0x14, 0x0F, 0x2F, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF, 0xFF, 0x0F, 0xFF,
+    0xFF, 0x00, 0xF2, 0x00, 0x00, 0x0F, 0x00, 0x0F, 0xFF, 0xFF, 0xF0, 0x85,
+    0xFF, 0x01, 0x00, 0xF0, 0x84, 0x00, 0x02, 0xFF, 0xF0, 0xF0, 0x85, 0xFF,
+    0x01, 0xF0, 0xF0, 0x84, 0x00, 0x03, 0xFF, 0xF0, 0xFF, 0xF0, 0x82, 0xFF,
+    0x12, 0xF0, 0xFF, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0xF0, 0xF0, 0xFF, 0xFF,
+    0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xF2, 0xFF, 0x00, 0x85, 0xF0, 0x00, 0xFF,
+    0xFF, 0xFF, 0x83, 0xFF, 0x83, 0xF0, 0x83, 0xFF, 0x83, 0xF0, 0x83, 0xFF,
+    0x82, 0xF0, 0x84, 0xFF, 0x82, 0xF0, 0x00, 0x00, 0x83, 0xFF, 0x82, 0xF0,
+    0x84, 0xFF, 0x82, 0xF0, 0x00, 0xF8, 0x83, 0xFF, 0x02, 0xF0, 0x00, 0xF0,
+    0x84, 0xFF, 0x82, 0xF0, 0x00, 0x00, 0x83, 0xFF, 0x01, 0xF0, 0xF0, 0x85,
+    0xFF, 0x03, 0xF0, 0xF0, 0x00, 0x00, 0x83, 0xFF, 0x01, 0xF0, 0xF0, 0x85,
+    0xFF, 0x82, 0xF0, 0x00, 0x00, 0x83, 0xFF, 0x82, 0xF0, 0x84, 0xFF, 0x83,
+    0xF0, 0x83, 0xFF, 0x83, 0xF0, 0x83, 0xFF, 0x03, 0xF9, 0xF0, 0x00, 0xF0,
+    0x82, 0xFF, 0x15, 0xF0, 0xF0, 0xFF, 0xF0, 0xFF, 0x00, 0x00, 0xF0, 0x00,
+    0x00, 0x0F, 0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xFF, 0xF0, 0xFF, 0xF0, 0xFF,
+    0x00, 0x82, 0xF0, 0x00, 0x02, 0x82, 0x00, 0x83, 0xF0, 0x83, 0xFF, 0x00,
+    0x00, 0x83, 0xF0, 0x82, 0x00, 0x00, 0xFF, 0x83, 0xF0, 0x82, 0xFF, 0x82,
+    0x00, 0x04, 0xF0, 0x00, 0xF0, 0x00, 0x00, 0x87, 0xFF, 0x82, 0x00, 0x00,
+    0x02, 0x83, 0x00, 0x84, 0xFF, 0x04, 0xF0, 0xFF, 0xFF, 0x00, 0xF0, 0x82,
+    0x00, 0x05, 0xF0, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x82, 0xF0, 0x05, 0xFF,
+    0xFF, 0xF0, 0x00, 0x08, 0x90, 0x82, 0xF0, 0x00, 0x00, 0x83, 0xFF, 0x03,
+    0xF0, 0x00, 0xF0, 0xFF, 0x84, 0x00, 0x02, 0xF0, 0xF0, 0x00, 0x00, 0xFF,
+    0x85, 0xF0, 0x02, 0xFF, 0x00, 0x00, 0x82, 0xF0, 0x01, 0x00, 0xF0, 0x82,
+    0xFF, 0x0E, 0xF0, 0xF0, 0xFF, 0xF0, 0xF0, 0xFF, 0x00, 0x00, 0xF0, 0xF2,
+    0x09, 0xF0, 0xF0, 0xFF, 0xFF, 0x82, 0xF0, 0x04, 0xFF, 0xF0, 0xF0, 0xFF,
+    0x00, 0x82, 0xF0, 0x03, 0x00, 0x00, 0xF0, 0xFF, 0x82, 0xF0, 0x82, 0xFF,
+    0x03, 0xF0, 0xFF, 0x00, 0xF0, 0x84, 0x00, 0x03, 0xFF, 0xFF, 0xF0, 0xF0,
+    0x82, 0xFF, 0x02, 0xF0, 0xFF, 0x00, 0x83, 0xF0, 0x02, 0x00, 0xFF, 0xFF,
+    0x83, 0xF0, 0x04, 0xF8, 0xF0, 0xFF, 0xFF, 0x00, 0x84, 0xF0, 0x01, 0x00,
+    0xFF, 0x84, 0xF0, 0x09, 0xFF, 0xF0, 0xFF, 0x00, 0xF0, 0xF0, 0x00, 0xF0,
+    0xF0, 0x00, 0x84, 0xFF, 0x82, 0xF0, 0x00, 0xFF, 0x84, 0x00, 0x02, 0xF0,
+    0xF9, 0xFF, 0x8D, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF,
+    0x00, 0x0F, 0x84, 0xFF, 0x83, 0x00, 0x83, 0xFF, 0x03, 0x0C, 0x00, 0x00,
+    0x0C, 0x83, 0xFF, 0x83, 0x00, 0x83, 0xFF, 0x83, 0x00, 0x83, 0xFF, 0x03,
+    0x0C, 0x00, 0x00, 0x0C, 0x83, 0xFF, 0x83, 0x00, 0x85, 0xFF, 0x00, 0x0F,
+    0x86, 0xFF, 0x00, 0x0F, 0x8E, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F,
+    0x86, 0xFF, 0x01, 0x0F, 0xFF, 0x9F, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00,
+    0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00,
+    0x0F, 0x86, 0xFF, 0x00, 0x0F, 0xB6, 0xFF, 0x86, 0xFF, 0x00, 0x0F, 0x86,
+    0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86,
+    0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x84, 0xFF, 0x02, 0x80, 0x00,
+    0x00, 0x84, 0xFF, 0x02, 0x0C, 0x00, 0x00, 0x84, 0xFF, 0x82, 0x00, 0x84,
+    0xFF, 0x82, 0x00, 0x84, 0xFF, 0x02, 0x0C, 0x00, 0x00, 0x84, 0xFF, 0x82,
+    0x00, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x8F, 0xFF, 0xAF,
+    0xFF, 0x01, 0x00, 0x0F, 0x85, 0xFF, 0x01, 0x0C, 0x0F, 0x85, 0xFF, 0x01,
+    0x00, 0x0F, 0x85, 0xFF, 0x01, 0x00, 0x0F, 0x85, 0xFF, 0x01, 0x0C, 0x0F,
+    0x85, 0xFF, 0x01, 0x00, 0x9F, 0xA5, 0xFF, 0x83, 0xFF, 0x83, 0x00, 0x83,
+    0xFF, 0x03, 0x0C, 0x00, 0x00, 0x0C, 0x83, 0xFF, 0x83, 0x00, 0x83, 0xFF,
+    0x83, 0x00, 0x83, 0xFF, 0x03, 0x0C, 0x00, 0x00, 0x0C, 0x83, 0xFF, 0x83,
+    0x00, 0x85, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x01,
+    0x0F, 0xFF, 0xB7, 0x00, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF,
+    0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF, 0x00, 0x0F, 0x86, 0xFF,
+    0x00, 0x0F, 0x9E, 0xFF, 0xB7, 0x00, 0xC7, 0xFF, 0xB7, 0x00, 0xC7, 0xFF,
+    0xB7, 0x00,
+    /* Spawns */
+    0x01, 0x00, 0x2F, 0x00, 0x03, 0x00, 0x02, 0x00, 0x25, 0x00, 0x04, 0x00,
+    0x02, 0x00, 0x3C, 0x00, 0x05, 0x00, 0x08, 0x00, 0x19, 0x00, 0x07, 0x00,
+    0x02, 0x00, 0x33, 0x00, 0x07, 0x00, 0x08, 0x00, 0x13, 0x00, 0x08, 0x00,
+    0x08, 0x00, 0x14, 0x00, 0x08, 0x00, 0x09, 0x00, 0x13, 0x00, 0x0A, 0x00,
+    0x09, 0x00, 0x14, 0x00, 0x0A, 0x00, 0x09, 0x00, 0x27, 0x00, 0x0B, 0x00,
+    0x02, 0x00, 0x2D, 0x00, 0x0D, 0x00, 0x02, 0x00, 0x3D, 0x00, 0x0E, 0x00,
+    0x09, 0x00, 0x19, 0x00, 0x0F, 0x00, 0x02, 0x00, 0x29, 0x00, 0x13, 0x00,
+    0x02, 0x00, 0x37, 0x00, 0x13, 0x00, 0x09, 0x00, 0x39, 0x00, 0x13, 0x00,
+    0x08, 0x00, 0x1F, 0x00, 0x15, 0x00, 0x02, 0x00, 0x27, 0x00, 0x19, 0x00,
+    0x08, 0x00, 0x39, 0x00, 0x1A, 0x00, 0x08, 0x00, 0x25, 0x00, 0x1D, 0x00,
+    0x09, 0x00, 0x26, 0x00, 0x1D, 0x00, 0x09, 0x00, 0x19, 0x00, 0x1F, 0x00,
+    0x09, 0x00, 0x3D, 0x00, 0x1F, 0x00, 0x08, 0x00, 0x2A, 0x00, 0x26, 0x00,
+    0x09, 0x00, 0x32, 0x00, 0x2B, 0x00,
+    /* Triggers */
+    0x2E, 0x00, 0x23, 0x00, 0x2E, 0x00, 0x23, 0x00, 0x02, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x23, 0x00, 0x2E, 0x00, 0x23, 0x00,
+    0x00, 0x02, 0x0A, 0x00, 0x26, 0x00, 0x00, 0x00, 0x2E, 0x00, 0x23, 0x00,
+    0x2E, 0x00, 0x23, 0x00, 0x00, 0x02, 0x0D, 0x00, 0x26, 0x00, 0x00, 0x00,
+    0x2E, 0x00, 0x23, 0x00, 0x2E, 0x00, 0x23, 0x00, 0x01, 0x00, 0x0C, 0x00,
+    0x21, 0x00, 0x00, 0x00, 0x08, 0x00, 0x21, 0x00, 0x10, 0x00, 0x29, 0x00,
+    0x00, 0x02, 0x0D, 0x00, 0x26, 0x00, 0x01, 0x00, 0x08, 0x00, 0x21, 0x00,
+    0x10, 0x00, 0x29, 0x00, 0x00, 0x02, 0x0A, 0x00, 0x26, 0x00, 0x03, 0x00,
+    0x08, 0x00, 0x21, 0x00, 0x10, 0x00, 0x29, 0x00, 0x00, 0x02, 0x0D, 0x00,
+    0x26, 0x00, 0x05, 0x00, 0x08, 0x00, 0x21, 0x00, 0x10, 0x00, 0x29, 0x00,
+    0x00, 0x02, 0x0A, 0x00, 0x26, 0x00, 0x07, 0x00, 0x08, 0x00, 0x21, 0x00,
+    0x10, 0x00, 0x29, 0x00, 0x00, 0x02, 0x0D, 0x00, 0x26, 0x00, 0x09, 0x00,
+    0x08, 0x00, 0x21, 0x00, 0x10, 0x00, 0x29, 0x00, 0x00, 0x02, 0x0A, 0x00,
+    0x26, 0x00, 0x0B, 0x00, 0x08, 0x00, 0x21, 0x00, 0x10, 0x00, 0x29, 0x00,
+    0x01, 0x01, 0x00, 0x00, 0x0C, 0x00, 0x0D, 0x00, 0x0C, 0x00, 0x37, 0x00,
+    0x17, 0x00, 0x38, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* Solid */
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0x80, 0x02, 0x02, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xBF,
+    0xEA, 0xBB, 0xFD, 0xF7, 0xFF, 0xFF, 0xFF, 0xA0, 0x2A, 0xAA, 0x80, 0x17,
+    0xFF, 0xFF, 0xFF, 0xAF, 0xAB, 0xAA, 0xBB, 0xDF, 0xFF, 0xFF, 0xFF, 0x88,
+    0x28, 0x2A, 0x20, 0x47, 0xFF, 0xFF, 0xC3, 0xFF, 0xEB, 0xEB, 0xEF, 0xFF,
+    0xFF, 0xFF, 0xC0, 0x80, 0x28, 0x08, 0x20, 0x03, 0xFF, 0xFF, 0xC3, 0xFF,
+    0xAB, 0xEF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0xAA, 0x28, 0xA0, 0x03,
+    0xFF, 0xFF, 0xFF, 0xEE, 0xAB, 0xAA, 0xBB, 0xFB, 0xFF, 0xFF, 0xFF, 0xAA,
+    0x88, 0xAA, 0x88, 0x2B, 0xFF, 0xFF, 0xFF, 0xAA, 0xFA, 0xAE, 0xEB, 0xAB,
+    0xFF, 0xFF, 0xFF, 0x8A, 0x82, 0xA0, 0x2A, 0xAB, 0xFF, 0xFF, 0xFF, 0xAA,
+    0xFE, 0xBB, 0xEA, 0xAB, 0xFF, 0xFF, 0xFF, 0xAA, 0x08, 0x1A, 0x0A, 0x8B,
+    0xFF, 0xFF, 0xFF, 0xAB, 0xEB, 0xBB, 0xFA, 0xEB, 0xFF, 0xFF, 0xFF, 0xA8,
+    0x2A, 0x00, 0x0A, 0x2B, 0xFF, 0xFF, 0xFF, 0xAB, 0xAA, 0xFF, 0xEA, 0xEB,
+    0xFF, 0xFF, 0xFF, 0xAA, 0x2A, 0x80, 0x2A, 0x0B, 0xFF, 0xFF, 0xFF, 0x8B,
+    0xEA, 0xBF, 0xAB, 0xFB, 0xFF, 0xFF, 0xFF, 0xA8, 0x02, 0x20, 0x20, 0x03,
+    0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xEB, 0xFB, 0xFF, 0xFF, 0xFF, 0xA0,
+    0x00, 0x00, 0x2A, 0x8F, 0xFF, 0xFF, 0xFF, 0xAF, 0xFF, 0xEF, 0xAA, 0xAF,
+    0xFF, 0xFF, 0xFF, 0xA8, 0x20, 0x20, 0x2A, 0xA3, 0xFF, 0xFF, 0xFF, 0xAB,
+    0xBE, 0xAF, 0xAA, 0xBB, 0xFF, 0xFF, 0xFF, 0xAA, 0x80, 0xA8, 0x28, 0xA3,
+    0xFF, 0xFF, 0xFF, 0xAA, 0xFF, 0x8B, 0xFF, 0xAB, 0xFF, 0xFF, 0xFF, 0xA2,
+    0x00, 0x28, 0x00, 0x2B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x41, 0x7F, 0xFF,
+    0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xD0, 0x5F, 0xFF, 0xFF, 0x41, 0x7F, 0xFF,
+    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xC0, 0x1F, 0xFF,
+    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xD0, 0x5F, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF,
+    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x41, 0x7F, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    /* Trigger index */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x0E, 0x00, 0x12, 0x00,
+    0x12, 0x00, 0x13, 0x00, 0x14, 0x00, 0x14, 0x00, 0x14, 0x00, 0x04, 0x00,
+    0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00, 0x0A, 0x00,
+    0x04, 0x00, 0x05, 0x00, 0x06, 0x00, 0x07, 0x00, 0x08, 0x00, 0x09, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x03, 0x00, 0x0B, 0x00,
+    0x0B, 0x00,
+    /* PVS */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0x60, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xE2, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC5,
+    0x82, 0x04, 0x00, 0x00, 0x00, 0x07, 0xEB, 0xC6, 0x0C, 0x00, 0x00, 0x00,
+    0x01, 0xC3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF7, 0x42, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0xF0, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xE1, 0x40,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0xC2, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x78, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xE3, 0x81, 0x02, 0x00, 0x00, 0x00, 0x03, 0xF0, 0xC1, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0xE1, 0x83, 0x03, 0x00, 0x00, 0x00, 0x01, 0xC0,
+    0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xE1, 0x80, 0x00, 0x00, 0x00,
+    0x01, 0xF1, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC4, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0x82, 0x04, 0x00, 0x00, 0x00, 0x01,
+    0xC3, 0x07, 0x08, 0x00, 0x00, 0x30, 0x43, 0x81, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x60, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x41, 0x81, 0x82, 0x00,
+    0x00, 0x00, 0x20, 0x40, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x71, 0xF1,
+    0xA0, 0x00, 0x00, 0x00, 0x00, 0x81, 0xE1, 0x42, 0x04, 0x00, 0x00, 0x00,
+    0x03, 0xC2, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x85, 0x02, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x81, 0x02, 0x06,
+    0x00, 0x00, 0x00, 0xC0, 0x81, 0x82, 0x00, 0x00, 0x18, 0x20, 0x40, 0xC0,
+    0x00, 0x00, 0x00, 0x10, 0x20, 0x41, 0x81, 0x80, 0x00, 0x00, 0x00, 0x20,
+    0xC0, 0xE1, 0x80, 0x00, 0x00, 0x00, 0x40, 0xC1, 0xC1, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC3, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xC1, 0x83,
+    0x04, 0x00, 0x00, 0x00, 0x01, 0x81, 0x02, 0x00, 0x00, 0x00, 0x03, 0xC0,
+    0x81, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x40, 0x81, 0x03, 0x06, 0x00, 0x00, 0x20, 0x40, 0xC1, 0x80, 0x00, 0x00,
+    0x00, 0x40, 0x81, 0x83, 0x80, 0x00, 0x00, 0x00, 0x00, 0x40, 0xF1, 0xA0,
+    0x00, 0x00, 0x00, 0x20, 0xC1, 0xE2, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE3,
+    0xC4, 0x80, 0x00, 0x00, 0x00, 0x00, 0x47, 0x89, 0x82, 0x04, 0x00, 0x00,
+    0x20, 0x40, 0xC1, 0x82, 0x04, 0x00, 0x00, 0x00, 0xC1, 0x83, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x40, 0x81, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x18, 0x20, 0x40, 0x81, 0x83, 0x00, 0x00, 0x00, 0x20, 0x60,
+    0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xC0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xC3, 0xF1,
+    0xA2, 0x00, 0x00, 0x10, 0x20, 0xE1, 0xE3, 0x46, 0x00, 0x00, 0x00, 0x60,
+    0xC3, 0xC6, 0x80, 0x00, 0x00, 0x10, 0x20, 0x47, 0x8D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0x40, 0xF1, 0x80, 0x00,
+    0x00, 0x20, 0x40, 0x81, 0xF3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0xF3,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF1, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x07, 0xE3, 0x40, 0x00, 0x00, 0x00, 0x00, 0x07, 0xC2, 0x80, 0x00, 0x00,
+    0x00, 0x20, 0x7F, 0x85, 0x00, 0x00, 0x00, 0x10, 0x20, 0xF0, 0x81, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x80, 0x00, 0x00, 0x10, 0x23, 0xC1,
+    0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x20,
+    0x60, 0xC0, 0x00, 0x00, 0x00, 0x20, 0x40, 0xE1, 0xF0, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xF7, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0x02, 0x04, 0x00, 0x10, 0x31, 0xC1, 0xE2, 0x00, 0x00, 0x00, 0x10,
+    0x20, 0x43, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x47, 0xC8, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xC1, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x87, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x78, 0x81, 0x07, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xE1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x41,
+    0xC3, 0x80, 0x00, 0x00, 0x00, 0x00, 0x83, 0x87, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xE1, 0xC1, 0x00, 0x00, 0x00, 0x20, 0x41, 0xC3, 0x82, 0x00, 0x00,
+    0x00, 0x00, 0x03, 0x87, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x70, 0xE0, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xE1, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x41, 0xC3, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0x70, 0xE0, 0x80, 0x00, 0x00, 0x10, 0x20, 0xE1,
+    0xC1, 0x00, 0x00, 0x00, 0x00, 0x41, 0xC3, 0x82, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x87, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x70, 0xE0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0xE1, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x41,
+    0xC3, 0x82, 0x00, 0x00, 0x00, 0x00, 0x83, 0x87, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x70, 0xE0, 0x80, 0x00,
+    0x00, 0x00, 0x20, 0xE1, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x41, 0xC3, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+#endif /* LEVEL_DATA_H */
+
+/* -------------------------------------------------------------------------- */
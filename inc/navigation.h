@@ -0,0 +1,81 @@
+/* Header guard ------------------------------------------------------------- */
+
+#ifndef NAVIGATION_H
+#define NAVIGATION_H
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "constants.h"
+#include "coords.h"
+#include "entities.h"
+#include "level.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+/* Flow field covers the area where entities are kept alive, in tiles */
+#define NAVIGATION_RADIUS (MAX_ENTITY_DISTANCE / DISTANCE_MULTIPLIER)
+#define NAVIGATION_SIZE   (NAVIGATION_RADIUS * 2 + 1)
+
+/* Distance from the tile center under which no correction is applied */
+#define NAVIGATION_DEADZONE 0.1f
+
+/* Function prototypes ------------------------------------------------------ */
+
+/**
+ * @brief NAVIGATION invalidate flow field, e.g. when a new level is loaded.
+ *
+ */
+void navigation_init(void);
+
+/**
+ * @brief NAVIGATION update flow field towards target.
+ * @details Breadth-first search over the level grid seeded at the target tile
+ * and bounded to NAVIGATION_RADIUS. Nothing is done while the target stays
+ * in the same tile, otherwise the line of sight cache is also cleared.
+ *
+ * @param level  Level
+ * @param target Target position
+ */
+void navigation_update(const Level *level, Coords *target);
+
+/**
+ * @brief NAVIGATION get movement direction towards flow field target.
+ *
+ * NOTE: Direction components are -1, 0 or 1, like SIGN().
+ *
+ * @param pos Current position
+ * @param dir Movement direction
+ * @return bool Direction is valid, false if target is unreachable, outside
+ * the flow field or in the same tile
+ */
+bool navigation_get_direction(Coords *pos, Coords *dir);
+
+/**
+ * @brief NAVIGATION check line of sight between target and position tiles.
+ * @details Walks the grid with the same DDA used by the raycaster, from the
+ * target tile center to the position tile center. Results are cached per
+ * tile until the target moves to another tile.
+ *
+ * @param level Level
+ * @param pos   Position to be checked
+ * @return bool Position is visible from target, false if outside the flow
+ * field
+ */
+bool navigation_is_visible(const Level *level, Coords *pos);
+
+/**
+ * @brief NAVIGATION update visibility flag of all enemies in one pass.
+ *
+ * @param level  Level
+ * @param entity Entities array
+ * @param num    Number of entities
+ */
+void navigation_update_visibility(const Level *level, Entity entity[],
+                                  uint8_t num);
+
+#endif /* NAVIGATION_H */
+
+/* -------------------------------------------------------------------------- */
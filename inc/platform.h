@@ -56,6 +56,22 @@ void platform_input_update(void);
  */
 uint32_t platform_millis(void);
 
+/**
+ * @brief PLATFORM get monotonic time in microseconds from start of execution,
+ * wrapping around every 71 minutes, so only compare times through unsigned
+ * 32-bit differences.
+ * 
+ * @return uint32_t Start time in microseconds
+ */
+uint32_t platform_micros(void);
+
+/**
+ * @brief PLATFORM get monotonic time in nanoseconds from start of execution.
+ * 
+ * @return uint64_t Start time in nanoseconds
+ */
+uint64_t platform_nanos(void);
+
 /**
  * @brief PLATFORM apply blocking delay in milliseconds.
  * 
@@ -63,6 +79,42 @@ uint32_t platform_millis(void);
  */
 void platform_delay(uint32_t ms);
 
+/**
+ * @brief PLATFORM sleep until the next frame deadline, deadlines being
+ * period_us apart, without busy waiting where possible.
+ * 
+ * @param period_us Frame period in microseconds
+ */
+void platform_wait_frame(uint32_t period_us);
+
+/**
+ * @brief PLATFORM map a read-only file into memory.
+ * 
+ * @param path File path
+ * @param size Size of the mapped file in bytes
+ * @return const uint8_t* Mapped file data, NULL if not available
+ */
+const uint8_t *platform_map_file(const char *path, uint32_t *size);
+
+/**
+ * @brief PLATFORM unmap a file mapped with platform_map_file.
+ * 
+ * @param data Mapped file data
+ * @param size Size of the mapped file in bytes
+ */
+void platform_unmap_file(const uint8_t *data, uint32_t size);
+
+#ifdef LEVEL_HOT_RELOAD
+/**
+ * @brief PLATFORM check if a file was written or replaced since the last call.
+ * 
+ * @param path File path
+ * @return true File changed
+ * @return false File unchanged or not watched
+ */
+bool platform_file_changed(const char *path);
+#endif
+
 #endif /* PLATFORM_H */
 
 /* -------------------------------------------------------------------------- */
\ No newline at end of file
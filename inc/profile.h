@@ -0,0 +1,61 @@
+/* Header guard ------------------------------------------------------------- */
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+
+#include "constants.h"
+
+/* Data types --------------------------------------------------------------- */
+
+typedef enum
+{
+    PROFILE_ENTITIES_UPDATED,
+    PROFILE_ENTITIES_SKIPPED,
+    PROFILE_ENTITIES_CULLED,
+    PROFILE_LOS_CULLED,
+    PROFILE_FRAME_IDLE,
+    PROFILE_FRAME_JITTER,
+    PROFILE_COUNTERS
+} ProfileCounter;
+
+/* Global variables --------------------------------------------------------- */
+
+extern uint16_t profile_counter[PROFILE_COUNTERS];
+
+/* Function prototypes ------------------------------------------------------ */
+
+/**
+ * @brief PROFILE print per-frame counters and reset them.
+ *
+ * NOTE: Does nothing unless PROFILE_ENABLE is set.
+ *
+ */
+void profile_report(void);
+
+/* Function definitions ----------------------------------------------------- */
+
+/**
+ * @brief PROFILE add value to a per-frame counter.
+ *
+ * NOTE: Compiled out unless PROFILE_ENABLE is set.
+ *
+ * @param counter Counter
+ * @param value   Value to add
+ */
+static inline void profile_add(ProfileCounter counter, uint16_t value)
+{
+#if PROFILE_ENABLE
+    profile_counter[counter] += value;
+#else
+    (void)counter;
+    (void)value;
+#endif
+}
+
+#endif /* PROFILE_H */
+
+/* -------------------------------------------------------------------------- */
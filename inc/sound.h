@@ -6,13 +6,41 @@
 /* Includes ----------------------------------------------------------------- */
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include "constants.h"
 
 /* Definitions -------------------------------------------------------------- */
 
+/* Voices mixed together, a new sound steals a voice of lower or equal
+ * priority when all of them are busy */
+#define SOUND_VOICES 4
+
+/* Square wave levels of the PCM oscillator, per voice so the mix never clips */
+#define SOUND_AMPLITUDE (INT16_MAX / SOUND_VOICES)
+
+/* Sounds change frequency every (1/140)s step */
+#define SOUND_STEP_RATE 140
+
+/* Build option, pre-render every sound once at this rate so playback only
+ * mixes cached samples, trading memory for audio callback time */
+#ifdef SOUND_PCM_CACHE
+#define SOUND_CACHE_RATE 44100
+#endif
+
+/* Patterns are compact sounds made of 2-byte events. A note event is an
+ * inverse frequency byte (0x00 rests) held for 1 to 255 steps. An event of
+ * zero steps is a command, 0x00 ends the pattern, otherwise the high nibble
+ * is a number of notes just before, played again as many more times as the
+ * low nibble. Repeated notes can not contain commands. */
+#define SOUND_PATTERN_END                  0x00, 0x00
+#define SOUND_PATTERN_REPEAT(notes, times) (((notes) << 4) | (times)), 0x00
+#define SOUND_PATTERN_MAX_NOTES            15
+#define SOUND_PATTERN_MAX_TIMES            15
+
 #define MUS_S1_SND_LEN 40
+#define MUS_S1_SND_PRIORITY 3
 static const uint8_t mus_s1_snd[MUS_S1_SND_LEN] = {
     0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
     0x99, 0x99, 0x99, 0x99, 0x00, 0x00, 0x00, 0x00, 0x99, 0x99, 0x99, 0x99,
@@ -20,41 +48,49 @@ static const uint8_t mus_s1_snd[MUS_S1_SND_LEN] = {
     0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P1_SND_LEN 20
+#define MUS_P1_SND_PRIORITY 3
 static const uint8_t mus_p1_snd[MUS_P1_SND_LEN] = {
     0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x20, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P2_SND_LEN 20
+#define MUS_P2_SND_PRIORITY 3
 static const uint8_t mus_p2_snd[MUS_P2_SND_LEN] = {
     0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
     0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P3_SND_LEN 20
+#define MUS_P3_SND_PRIORITY 3
 static const uint8_t mus_p3_snd[MUS_P3_SND_LEN] = {
     0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43, 0x43,
     0x43, 0x43, 0x43, 0x43, 0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P4_SND_LEN 20
+#define MUS_P4_SND_PRIORITY 3
 static const uint8_t mus_p4_snd[MUS_P4_SND_LEN] = {
     0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
     0x58, 0x58, 0x58, 0x58, 0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P5_SND_LEN 20
+#define MUS_P5_SND_PRIORITY 3
 static const uint8_t mus_p5_snd[MUS_P5_SND_LEN] = {
     0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53, 0x53,
     0x53, 0x53, 0x53, 0x53, 0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P6_SND_LEN 20
+#define MUS_P6_SND_PRIORITY 3
 static const uint8_t mus_p6_snd[MUS_P6_SND_LEN] = {
     0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48, 0x48,
     0x48, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P7_SND_LEN 20
+#define MUS_P7_SND_PRIORITY 3
 static const uint8_t mus_p7_snd[MUS_P7_SND_LEN] = {
     0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58,
     0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58, 0x58};
 
 #define MUS_S21_SND_LEN 40
+#define MUS_S21_SND_PRIORITY 3
 static const uint8_t mus_s21_snd[MUS_S21_SND_LEN] = {
     0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
     0x89, 0x89, 0x89, 0x89, 0x00, 0x00, 0x00, 0x00, 0x89, 0x89, 0x89, 0x89,
@@ -62,26 +98,31 @@ static const uint8_t mus_s21_snd[MUS_S21_SND_LEN] = {
     0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P21_SND_LEN 20
+#define MUS_P21_SND_PRIORITY 3
 static const uint8_t mus_p21_snd[MUS_P21_SND_LEN] = {
     0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15,
     0x15, 0x15, 0x15, 0x15, 0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P22_SND_LEN 20
+#define MUS_P22_SND_PRIORITY 3
 static const uint8_t mus_p22_snd[MUS_P22_SND_LEN] = {
     0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23, 0x23,
     0x23, 0x23, 0x23, 0x23, 0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P24_SND_LEN 20
+#define MUS_P24_SND_PRIORITY 3
 static const uint8_t mus_p24_snd[MUS_P24_SND_LEN] = {
     0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
     0x38, 0x38, 0x38, 0x38, 0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P26_SND_LEN 20
+#define MUS_P26_SND_PRIORITY 3
 static const uint8_t mus_p26_snd[MUS_P26_SND_LEN] = {
     0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35, 0x35,
     0x35, 0x35, 0x35, 0x35, 0x00, 0x00, 0x00, 0x00};
 
 #define MUS_P27_SND_LEN 40
+#define MUS_P27_SND_PRIORITY 3
 static const uint8_t mus_p27_snd[MUS_P27_SND_LEN] = {
     0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38,
     0x38, 0x38, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x31, 0x31, 0x31, 0x31,
@@ -89,6 +130,7 @@ static const uint8_t mus_p27_snd[MUS_P27_SND_LEN] = {
     0x24, 0x24, 0x24, 0x24};
 
 #define MUS_P28_SND_LEN 40
+#define MUS_P28_SND_PRIORITY 3
 static const uint8_t mus_p28_snd[MUS_P28_SND_LEN] = {
     0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
     0x45, 0x45, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x24, 0x24, 0x24, 0x24,
@@ -96,6 +138,7 @@ static const uint8_t mus_p28_snd[MUS_P28_SND_LEN] = {
     0x10, 0x10, 0x10, 0x10};
 
 #define MUS_P29_SND_LEN 40
+#define MUS_P29_SND_PRIORITY 3
 static const uint8_t mus_p29_snd[MUS_P29_SND_LEN] = {
     0x17, 0x17, 0x17, 0x17, 0x17, 0x17, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
     0x24, 0x24, 0x31, 0x31, 0x31, 0x31, 0x31, 0x31, 0x45, 0x45, 0x45, 0x45,
@@ -103,6 +146,7 @@ static const uint8_t mus_p29_snd[MUS_P29_SND_LEN] = {
     0x45, 0x45, 0x45, 0x45};
 
 #define MUS_EP_SND_LEN 40
+#define MUS_EP_SND_PRIORITY 3
 static const uint8_t mus_ep_snd[MUS_EP_SND_LEN] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
@@ -110,16 +154,19 @@ static const uint8_t mus_ep_snd[MUS_EP_SND_LEN] = {
     0x00, 0x00, 0x00, 0x00};
 
 #define MUS_EP2_SND_LEN 20
+#define MUS_EP2_SND_PRIORITY 3
 static const uint8_t mus_ep2_snd[MUS_EP2_SND_LEN] = {
     0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45,
     0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45, 0x45};
 
 #define JUMP_SND_LEN 20
+#define JUMP_SND_PRIORITY 1
 static const uint8_t jump_snd[JUMP_SND_LEN] = {
     0x80, 0x80, 0x80, 0x80, 0x80, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
     0x00, 0x00, 0x00, 0x25, 0x25, 0x25, 0x25, 0x25};
 
 #define S_SND_LEN 40
+#define S_SND_PRIORITY 3
 static const uint8_t s_snd[S_SND_LEN] = {
     0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x60, 0x60,
     0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x30, 0x30, 0x30, 0x30,
@@ -127,12 +174,15 @@ static const uint8_t s_snd[S_SND_LEN] = {
     0x10, 0x10, 0x10, 0x10};
 
 #define R1_SND_LEN 6
+#define R1_SND_PRIORITY 1
 static const uint8_t r1_snd[R1_SND_LEN] = {0x95, 0x95, 0x95, 0x95, 0x95, 0x95};
 
 #define R2_SND_LEN 6
+#define R2_SND_PRIORITY 1
 static const uint8_t r2_snd[R2_SND_LEN] = {0x50, 0x50, 0x50, 0x50, 0x50, 0x50};
 
 #define SHOT_SND_LEN 54
+#define SHOT_SND_PRIORITY 2
 static const uint8_t shot_snd[SHOT_SND_LEN] = {
     0x10, 0x10, 0x10, 0x6e, 0x2a, 0x20, 0x28, 0x28, 0x9b, 0x28, 0x20, 0x20,
     0x21, 0x57, 0x20, 0x20, 0x20, 0x67, 0x20, 0x20, 0x29, 0x20, 0x73, 0x20,
@@ -141,12 +191,14 @@ static const uint8_t shot_snd[SHOT_SND_LEN] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
 
 #define SHOOT_SND_LEN 27
+#define SHOOT_SND_PRIORITY 2
 static const uint8_t shoot_snd[SHOOT_SND_LEN] = {
     0x10, 0x10, 0x10, 0x6e, 0x2a, 0x20, 0x28, 0x28, 0x9b, 0x28, 0x20, 0x20,
     0x21, 0x57, 0x20, 0x20, 0x20, 0x67, 0x20, 0x20, 0x29, 0x20, 0x73, 0x20,
     0x20, 0x20, 0x89};
 
 #define GET_KEY_SND_LEN 90
+#define GET_KEY_SND_PRIORITY 3
 static const uint8_t get_key_snd[GET_KEY_SND_LEN] = {
     0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24,
     0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x24, 0x20,
@@ -158,16 +210,20 @@ static const uint8_t get_key_snd[GET_KEY_SND_LEN] = {
     0x19, 0x19, 0x19, 0x19, 0x19, 0x19};
 
 #define HIT_WALL_SND_LEN 8
+#define HIT_WALL_SND_PRIORITY 2
 static const uint8_t hit_wall_snd[HIT_WALL_SND_LEN] = {
     0x83, 0x83, 0x82, 0x8e, 0x8a, 0x89, 0x86, 0x84};
 
 #define WALK1_SND_LEN 3
+#define WALK1_SND_PRIORITY 0
 static const uint8_t walk1_snd[WALK1_SND_LEN] = {0x8f, 0x8e, 0x8e};
 
-#define WALK2_SND_LEN  3
+#define WALK2_SND_LEN 3
+#define WALK2_SND_PRIORITY 0
 static const uint8_t walk2_snd[WALK2_SND_LEN] = {0x84, 0x87, 0x84};
 
 #define MEDKIT_SND_LEN 71
+#define MEDKIT_SND_PRIORITY 3
 static const uint8_t medkit_snd[MEDKIT_SND_LEN] = {
     0x55, 0x20, 0x3a, 0x3a, 0x3a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
     0x33, 0x33, 0x33, 0x33, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
@@ -177,8 +233,49 @@ static const uint8_t medkit_snd[MEDKIT_SND_LEN] = {
     0x20, 0x20, 0x20, 0x20, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15};
 
 #define MELEE_SND_LEN 3
+#define MELEE_SND_PRIORITY 2
 static const uint8_t melee_snd[MELEE_SND_LEN] = {0x8f, 0x8e, 0x8e};
 
+/* Every sound above as X(name, NAME), for tables of name##_snd and
+ * NAME##_SND_LEN */
+#define SOUND_LIST(X)     \
+    X(mus_s1, MUS_S1)     \
+    X(mus_p1, MUS_P1)     \
+    X(mus_p2, MUS_P2)     \
+    X(mus_p3, MUS_P3)     \
+    X(mus_p4, MUS_P4)     \
+    X(mus_p5, MUS_P5)     \
+    X(mus_p6, MUS_P6)     \
+    X(mus_p7, MUS_P7)     \
+    X(mus_s21, MUS_S21)   \
+    X(mus_p21, MUS_P21)   \
+    X(mus_p22, MUS_P22)   \
+    X(mus_p24, MUS_P24)   \
+    X(mus_p26, MUS_P26)   \
+    X(mus_p27, MUS_P27)   \
+    X(mus_p28, MUS_P28)   \
+    X(mus_p29, MUS_P29)   \
+    X(mus_ep, MUS_EP)     \
+    X(mus_ep2, MUS_EP2)   \
+    X(jump, JUMP)         \
+    X(s, S)               \
+    X(r1, R1)             \
+    X(r2, R2)             \
+    X(shot, SHOT)         \
+    X(shoot, SHOOT)       \
+    X(get_key, GET_KEY)   \
+    X(hit_wall, HIT_WALL) \
+    X(walk1, WALK1)       \
+    X(walk2, WALK2)       \
+    X(medkit, MEDKIT)     \
+    X(melee, MELEE)
+
+/* Built-in patterns -------------------------------------------------------- */
+
+#ifndef SOUND_NO_DATA
+#include "sound_data.h"
+#endif
+
 /* Function prototypes ------------------------------------------------------ */
 
 /**
@@ -189,26 +286,109 @@ void sound_init(void);
 
 /**
  * @brief SOUND update sound and execute platform audio player.
+ * @details The sound is queued for the audio callback, which starts it on its
+ * next sound_render call in a free voice. When all voices are busy, it
+ * restarts the voice already playing the same sound, or steals the lowest
+ * priority voice closest to its end, or is dropped if every voice has a
+ * higher priority.
  *
- * @param snd    Sound byte array
- * @param len    Byte length of sound
- * @param enable Enable speakers
+ * @param snd      Sound byte array
+ * @param len      Byte length of sound
+ * @param priority Sound priority, higher values steal lower ones
+ * @param enable   Enable speakers
  */
-void sound_play(const uint8_t *snd, uint8_t len, bool enable);
+void sound_play(const uint8_t *snd, uint8_t len, uint8_t priority,
+                bool enable);
 
 /**
- * @brief SOUND get a new frequency from current sound every (1/140)s period,
- * otherwise return the same one again. Return zero if sound is finished.
+ * @brief SOUND play a pattern like sound_play, see SOUND_PATTERN_END.
+ * @details Pattern voices always count as the longest sounds when stealing.
+ *
+ * @param pattern  Pattern byte array
+ * @param priority Sound priority, higher values steal lower ones
+ * @param loop     Restart the pattern at its end
+ * @param enable   Enable speakers
+ */
+void sound_play_pattern(const uint8_t *pattern, uint8_t priority, bool loop,
+                        bool enable);
+
+/**
+ * @brief SOUND get frequency of the current step of the highest priority
+ * voice, for single tone speakers. Return zero if sound is finished or paused.
  *
  * NOTE: Sounds use inverse frequency format, for more information see:
  * 1. http://fabiensanglard.net/gebbwolf3d_v2.1.pdf chapter 4.9.5
  * 2. http://www.shikadi.net/moddingwiki/Inverse_Frequency_Sound_format
  * 3. http://www.shikadi.net/moddingwiki/AudioT_Format
  *
- * @return uint16_t Next sound frequency
+ * @return uint16_t Current sound frequency
  */
 uint16_t sound_get_frequency(void);
 
+/**
+ * @brief SOUND render the mix of all voices into PCM buffer, silence once
+ * finished.
+ * @details Sound steps are clocked by the number of rendered samples, a step
+ * ends at sample ceil((step + 1) * rate / SOUND_STEP_RATE), so frequency
+ * changes at exact sample offsets whatever the buffer size is. The cost is
+ * at most one addition per voice and sample.
+ *
+ * @param buffer Signed 16-bit mono samples
+ * @param frames Number of samples
+ * @param rate   Sampling rate in Hz
+ * @return bool A sound is still playing
+ */
+bool sound_render(int16_t *buffer, size_t frames, uint32_t rate);
+
+/**
+ * @brief SOUND render the mix of all voices into a PWM DMA buffer, as duty
+ * values from 0 to period, period / 2 being silence.
+ * @details Same as sound_render, with the samples converted in place, so a
+ * port fills a whole DMA buffer with a single call from its half or full
+ * transfer interrupt.
+ *
+ * @param duty   PWM duty values
+ * @param frames Number of samples
+ * @param rate   Sampling rate in Hz
+ * @param period PWM timer period
+ * @return bool A sound is still playing
+ */
+bool sound_render_pwm(uint16_t *duty, size_t frames, uint32_t rate,
+                      uint16_t period);
+
+/**
+ * @brief SOUND add a square wave to PCM buffer for speaker emulation.
+ * @details Phase accumulator oscillator, a 32-bit phase wraps once per
+ * period, so the wave continues across buffers and the phase step is the
+ * only division per buffer.
+ *
+ * @param buffer    Signed 16-bit mono samples
+ * @param frames    Number of samples
+ * @param frequency Square wave frequency in Hz
+ * @param rate      Sampling rate in Hz
+ * @param phase     Oscillator phase, updated for the next buffer
+ */
+void sound_mix_square(int16_t *buffer, uint32_t frames, uint16_t frequency,
+                      uint32_t rate, uint32_t *phase);
+
+/* Build option of the host stress test, which defines this hook */
+#ifdef SOUND_QUEUE_TRACE
+/**
+ * @brief SOUND trace a command through the queue, called from sound_play and
+ * sound_play_pattern with every command rejected on a full queue, and from
+ * sound_render with every command taken from the queue, in queue order.
+ *
+ * @param snd      Sound byte array
+ * @param len      Byte length of sound
+ * @param priority Sound priority
+ * @param pattern  Sound is a pattern
+ * @param loop     Restart the pattern at its end
+ * @param queued   Command went through the queue, otherwise it was rejected
+ */
+void sound_queue_trace(const uint8_t *snd, uint8_t len, uint8_t priority,
+                       bool pattern, bool loop, bool queued);
+#endif
+
 #endif /* SOUND_H */
 
 /* -------------------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,146 @@
+/* Generated by tools/sndpat.c from inc/sound.h, do not edit */
+
+/* Header guard ------------------------------------------------------------- */
+
+#ifndef SOUND_DATA_H
+#define SOUND_DATA_H
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+
+#define MUS_S1_PAT_SIZE 8
+static const uint8_t mus_s1_pat[MUS_S1_PAT_SIZE] = {
+    0x99, 0x10, 0x00, 0x04, 0x21, 0x00, 0x00, 0x00};
+
+#define MUS_P1_PAT_SIZE 6
+static const uint8_t mus_p1_pat[MUS_P1_PAT_SIZE] = {
+    0x20, 0x10, 0x00, 0x04, 0x00, 0x00};
+
+#define MUS_P2_PAT_SIZE 6
+static const uint8_t mus_p2_pat[MUS_P2_PAT_SIZE] = {
+    0x33, 0x10, 0x00, 0x04, 0x00, 0x00};
+
+#define MUS_P3_PAT_SIZE 6
+static const uint8_t mus_p3_pat[MUS_P3_PAT_SIZE] = {
+    0x43, 0x10, 0x00, 0x04, 0x00, 0x00};
+
+#define MUS_P4_PAT_SIZE 6
+static const uint8_t mus_p4_pat[MUS_P4_PAT_SIZE] = {
+    0x58, 0x10, 0x00, 0x04, 0x00, 0x00};
+
+#define MUS_P5_PAT_SIZE 6
+static const uint8_t mus_p5_pat[MUS_P5_PAT_SIZE] = {
+    0x53, 0x10, 0x00, 0x04, 0x00, 0x00};
+
+#define MUS_P6_PAT_SIZE 6
+static const uint8_t mus_p6_pat[MUS_P6_PAT_SIZE] = {
+    0x48, 0x10, 0x00, 0x04, 0x00, 0x00};
+
+#define MUS_P7_PAT_SIZE 4
+static const uint8_t mus_p7_pat[MUS_P7_PAT_SIZE] = {
+    0x58, 0x14, 0x00, 0x00};
+
+#define MUS_S21_PAT_SIZE 8
+static const uint8_t mus_s21_pat[MUS_S21_PAT_SIZE] = {
+    0x89, 0x10, 0x00, 0x04, 0x21, 0x00, 0x00, 0x00};
+
+#define MUS_P21_PAT_SIZE 6
+static const uint8_t mus_p21_pat[MUS_P21_PAT_SIZE] = {
+    0x15, 0x10, 0x00, 0x04, 0x00, 0x00};
+
+#define MUS_P22_PAT_SIZE 6
+static const uint8_t mus_p22_pat[MUS_P22_PAT_SIZE] = {
+    0x23, 0x10, 0x00, 0x04, 0x00, 0x00};
+
+#define MUS_P24_PAT_SIZE 6
+static const uint8_t mus_p24_pat[MUS_P24_PAT_SIZE] = {
+    0x38, 0x10, 0x00, 0x04, 0x00, 0x00};
+
+#define MUS_P26_PAT_SIZE 6
+static const uint8_t mus_p26_pat[MUS_P26_PAT_SIZE] = {
+    0x35, 0x10, 0x00, 0x04, 0x00, 0x00};
+
+#define MUS_P27_PAT_SIZE 14
+static const uint8_t mus_p27_pat[MUS_P27_PAT_SIZE] = {
+    0x31, 0x06, 0x38, 0x08, 0x45, 0x06, 0x31, 0x06, 0x17, 0x08, 0x24, 0x06,
+    0x00, 0x00};
+
+#define MUS_P28_PAT_SIZE 14
+static const uint8_t mus_p28_pat[MUS_P28_PAT_SIZE] = {
+    0x31, 0x06, 0x45, 0x08, 0x31, 0x06, 0x24, 0x06, 0x17, 0x08, 0x10, 0x06,
+    0x00, 0x00};
+
+#define MUS_P29_PAT_SIZE 10
+static const uint8_t mus_p29_pat[MUS_P29_PAT_SIZE] = {
+    0x17, 0x06, 0x24, 0x08, 0x31, 0x06, 0x45, 0x14, 0x00, 0x00};
+
+#define MUS_EP_PAT_SIZE 4
+static const uint8_t mus_ep_pat[MUS_EP_PAT_SIZE] = {
+    0x00, 0x28, 0x00, 0x00};
+
+#define MUS_EP2_PAT_SIZE 4
+static const uint8_t mus_ep2_pat[MUS_EP2_PAT_SIZE] = {
+    0x45, 0x14, 0x00, 0x00};
+
+#define JUMP_PAT_SIZE 10
+static const uint8_t jump_pat[JUMP_PAT_SIZE] = {
+    0x80, 0x05, 0x55, 0x05, 0x00, 0x05, 0x25, 0x05, 0x00, 0x00};
+
+#define S_PAT_SIZE 10
+static const uint8_t s_pat[S_PAT_SIZE] = {
+    0x80, 0x0A, 0x60, 0x0A, 0x30, 0x0A, 0x10, 0x0A, 0x00, 0x00};
+
+#define R1_PAT_SIZE 4
+static const uint8_t r1_pat[R1_PAT_SIZE] = {
+    0x95, 0x06, 0x00, 0x00};
+
+#define R2_PAT_SIZE 4
+static const uint8_t r2_pat[R2_PAT_SIZE] = {
+    0x50, 0x06, 0x00, 0x00};
+
+#define SHOT_PAT_SIZE 40
+static const uint8_t shot_pat[SHOT_PAT_SIZE] = {
+    0x10, 0x03, 0x6E, 0x01, 0x2A, 0x01, 0x20, 0x01, 0x28, 0x02, 0x9B, 0x01,
+    0x28, 0x01, 0x20, 0x02, 0x21, 0x01, 0x57, 0x01, 0x20, 0x03, 0x67, 0x01,
+    0x20, 0x02, 0x29, 0x01, 0x20, 0x01, 0x73, 0x01, 0x20, 0x03, 0x89, 0x01,
+    0x00, 0x1B, 0x00, 0x00};
+
+#define SHOOT_PAT_SIZE 38
+static const uint8_t shoot_pat[SHOOT_PAT_SIZE] = {
+    0x10, 0x03, 0x6E, 0x01, 0x2A, 0x01, 0x20, 0x01, 0x28, 0x02, 0x9B, 0x01,
+    0x28, 0x01, 0x20, 0x02, 0x21, 0x01, 0x57, 0x01, 0x20, 0x03, 0x67, 0x01,
+    0x20, 0x02, 0x29, 0x01, 0x20, 0x01, 0x73, 0x01, 0x20, 0x03, 0x89, 0x01,
+    0x00, 0x00};
+
+#define GET_KEY_PAT_SIZE 18
+static const uint8_t get_key_pat[GET_KEY_PAT_SIZE] = {
+    0x24, 0x17, 0x20, 0x07, 0x37, 0x0A, 0x20, 0x04, 0x21, 0x00, 0x37, 0x0A,
+    0x20, 0x06, 0x19, 0x10, 0x00, 0x00};
+
+#define HIT_WALL_PAT_SIZE 16
+static const uint8_t hit_wall_pat[HIT_WALL_PAT_SIZE] = {
+    0x83, 0x02, 0x82, 0x01, 0x8E, 0x01, 0x8A, 0x01, 0x89, 0x01, 0x86, 0x01,
+    0x84, 0x01, 0x00, 0x00};
+
+#define WALK1_PAT_SIZE 6
+static const uint8_t walk1_pat[WALK1_PAT_SIZE] = {
+    0x8F, 0x01, 0x8E, 0x02, 0x00, 0x00};
+
+#define WALK2_PAT_SIZE 8
+static const uint8_t walk2_pat[WALK2_PAT_SIZE] = {
+    0x84, 0x01, 0x87, 0x01, 0x84, 0x01, 0x00, 0x00};
+
+#define MEDKIT_PAT_SIZE 28
+static const uint8_t medkit_pat[MEDKIT_PAT_SIZE] = {
+    0x55, 0x01, 0x20, 0x01, 0x3A, 0x03, 0x20, 0x07, 0x33, 0x04, 0x20, 0x09,
+    0x26, 0x03, 0x20, 0x07, 0x16, 0x05, 0x20, 0x09, 0x16, 0x06, 0x20, 0x09,
+    0x15, 0x07, 0x00, 0x00};
+
+#define MELEE_PAT_SIZE 6
+static const uint8_t melee_pat[MELEE_PAT_SIZE] = {
+    0x8F, 0x01, 0x8E, 0x02, 0x00, 0x00};
+
+#endif /* SOUND_DATA_H */
+
+/* -------------------------------------------------------------------------- */
@@ -17,6 +17,7 @@
 /* Function prototypes ------------------------------------------------------ */
 
 uint32_t millis(void);
+uint32_t micros(void);
 void delay(uint32_t ms);
 
 #endif /* UTILS_H */
@@ -0,0 +1,159 @@
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "automap.h"
+#include "display.h"
+#include "level.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+/* Enemy markers toggle every 8 frames, power of two */
+#define AUTOMAP_BLINK_FRAMES 8
+
+/* Function prototypes ------------------------------------------------------ */
+
+static void automap_draw_tile_pixel(int16_t x, int16_t y, bool color);
+
+/* Global variables --------------------------------------------------------- */
+
+/* Page-major image, same layout as the display buffer */
+static uint8_t automap_image[AUTOMAP_PAGES * AUTOMAP_WIDTH];
+static uint16_t automap_height = 0;
+static uint8_t automap_shift = 0;
+static uint8_t automap_x = 0;
+static uint8_t automap_frame = 0;
+
+/* Function definitions ----------------------------------------------------- */
+
+/**
+ * @brief AUTOMAP clear explored map and fit the level into the automap image.
+ * @details Levels larger than the image are downsampled by a power of two, a
+ * pixel being set when any revealed wall of its block of tiles is.
+ *
+ * @param level Level
+ */
+void automap_init(const Level *level)
+{
+    memset(automap_image, 0x00, sizeof(automap_image));
+
+    automap_height = level->height;
+    automap_shift = 0;
+    while ((((level->width - 1) >> automap_shift) >= AUTOMAP_WIDTH) ||
+           (((level->height - 1) >> automap_shift) >= AUTOMAP_HEIGHT))
+        automap_shift++;
+
+    // Centered horizontally, pages can only be copied at the top
+    automap_x = (SCREEN_WIDTH - ((level->width - 1) >> automap_shift) - 1) / 2;
+}
+
+/**
+ * @brief AUTOMAP mark a wall tile as revealed, e.g. when hit by the raycaster.
+ *
+ * @param x X coordinate
+ * @param y Y coordinate
+ */
+void automap_reveal(int16_t x, int16_t y)
+{
+    if ((x < 0) || (y < 0) || (y >= automap_height))
+        return;
+
+    // Level rows go up from the bottom one, image rows go down from the top
+    uint16_t px = (uint16_t)x >> automap_shift;
+    uint16_t py = (uint16_t)(automap_height - 1 - y) >> automap_shift;
+
+    if ((px >= AUTOMAP_WIDTH) || (py >= AUTOMAP_HEIGHT))
+        return;
+
+    automap_image[(py / 8) * AUTOMAP_WIDTH + px] |= (1 << (py & 7));
+}
+
+/**
+ * @brief AUTOMAP draw explored map over the raycasting area of the display
+ * buffer.
+ *
+ * NOTE: The image uses the display buffer layout, so it is copied byte by
+ * byte, one byte encoding 8 pixels in a vertical line.
+ *
+ */
+void automap_draw(void)
+{
+    automap_frame++;
+
+    for (uint8_t page = 0; page < AUTOMAP_PAGES; page++)
+    {
+        uint8_t *dst = &display_buf[page * SCREEN_WIDTH];
+        const uint8_t *src = &automap_image[page * AUTOMAP_WIDTH];
+
+        // Last page may be shared with the HUD
+        uint8_t mask = 0xff;
+        if ((page + 1) * 8 > AUTOMAP_HEIGHT)
+            mask = (1 << (AUTOMAP_HEIGHT & 7)) - 1;
+
+        for (uint8_t x = 0; x < SCREEN_WIDTH; x++)
+        {
+            uint8_t byte = 0;
+            if ((x >= automap_x) && (x < automap_x + AUTOMAP_WIDTH))
+                byte = src[x - automap_x];
+
+            dst[x] = (dst[x] & ~mask) | (byte & mask);
+        }
+    }
+}
+
+/**
+ * @brief AUTOMAP draw player marker, a cross with a pixel facing its
+ * direction.
+ *
+ * @param pos Player position
+ * @param dir Player direction
+ */
+void automap_draw_player(const Coords *pos, const Coords *dir)
+{
+    int16_t x = (int16_t)pos->x >> automap_shift;
+    int16_t y = (automap_height - 1 - (int16_t)pos->y) >> automap_shift;
+
+    automap_draw_tile_pixel(x, y, COLOR_WHITE);
+    automap_draw_tile_pixel(x - 1, y, COLOR_WHITE);
+    automap_draw_tile_pixel(x + 1, y, COLOR_WHITE);
+    automap_draw_tile_pixel(x, y - 1, COLOR_WHITE);
+    automap_draw_tile_pixel(x, y + 1, COLOR_WHITE);
+
+    // Two pixels away, so it does not merge with the cross. Y is flipped
+    // like the rows.
+    automap_draw_tile_pixel(x + (int16_t)roundf(dir->x * 2.0f),
+                            y - (int16_t)roundf(dir->y * 2.0f), COLOR_WHITE);
+}
+
+/**
+ * @brief AUTOMAP draw blinking enemy marker.
+ *
+ * @param pos Enemy position
+ */
+void automap_draw_enemy(const Coords *pos)
+{
+    int16_t x = (int16_t)pos->x >> automap_shift;
+    int16_t y = (automap_height - 1 - (int16_t)pos->y) >> automap_shift;
+
+    automap_draw_tile_pixel(x, y, (automap_frame & AUTOMAP_BLINK_FRAMES) != 0);
+}
+
+/**
+ * @brief AUTOMAP draw pixel of automap image coordinates to display buffer.
+ *
+ * @param x     X coordinate
+ * @param y     Y coordinate
+ * @param color Pixel color
+ */
+void automap_draw_tile_pixel(int16_t x, int16_t y, bool color)
+{
+    if ((x < 0) || (x >= AUTOMAP_WIDTH) || (y < 0) || (y >= AUTOMAP_HEIGHT))
+        return;
+
+    display_draw_pixel(automap_x + x, y, color, true);
+}
+
+/* -------------------------------------------------------------------------- */
\ No newline at end of file
@@ -14,6 +14,7 @@ uint8_t zbuffer[ZBUFFER_SIZE];
 uint8_t display_buf[DISPLAY_BUF_SIZE];
 
 float delta_time;
+uint32_t anim_time;
 static uint32_t last_frame_time;
 
 /* Function definitions ----------------------------------------------------- */
@@ -28,6 +29,7 @@ void display_init(void)
     memset(zbuffer, 0xff, ZBUFFER_SIZE);
 
     delta_time = 1.0f;
+    anim_time = 0;
     last_frame_time = 0;
 }
 
@@ -115,12 +117,14 @@ bool display_get_gradient(uint8_t x, uint8_t y, uint8_t i)
  */
 void display_delay_fps(void)
 {
-    while (platform_millis() - last_frame_time < FRAME_TIME)
-    {
-    };
-
-    delta_time = (float)(platform_millis() - last_frame_time) / FRAME_TIME;
-    last_frame_time = platform_millis();
+    platform_wait_frame(FRAME_TIME_US);
+
+    // Unsigned difference stays right across the microsecond clock wrap
+    uint32_t now = platform_micros();
+    uint32_t elapsed = now - last_frame_time;
+    delta_time = (float)elapsed / FRAME_TIME_US;
+    anim_time = (anim_time + elapsed) % ANIM_PERIOD_US;
+    last_frame_time = now;
 }
 
 /**
@@ -4,6 +4,27 @@
 
 #include "entities.h"
 #include "level.h"
+#include "utils.h"
+
+/* Global variables --------------------------------------------------------- */
+
+/* Unit vectors of every direction, fixed point scaled by INT8_MAX */
+static const int8_t entities_direction[FIREBALL_DIRECTIONS][2] = {
+    {127, 0}, {127, 9}, {126, 18}, {124, 26}, {122, 35}, {119, 43}, {116, 52},
+    {112, 60}, {108, 67}, {103, 75}, {97, 82}, {91, 88}, {85, 94}, {78, 100},
+    {71, 105}, {64, 110}, {56, 114}, {48, 118}, {39, 121}, {31, 123},
+    {22, 125}, {13, 126}, {4, 127}, {-4, 127}, {-13, 126}, {-22, 125},
+    {-31, 123}, {-39, 121}, {-48, 118}, {-56, 114}, {-63, 110}, {-71, 105},
+    {-78, 100}, {-85, 94}, {-91, 88}, {-97, 82}, {-103, 75}, {-108, 67},
+    {-112, 60}, {-116, 52}, {-119, 43}, {-122, 35}, {-124, 26}, {-126, 18},
+    {-127, 9}, {-127, 0}, {-127, -9}, {-126, -18}, {-124, -26}, {-122, -35},
+    {-119, -43}, {-116, -52}, {-112, -60}, {-108, -67}, {-103, -75},
+    {-97, -82}, {-91, -88}, {-85, -94}, {-78, -100}, {-71, -105}, {-64, -110},
+    {-56, -114}, {-48, -118}, {-39, -121}, {-31, -123}, {-22, -125},
+    {-13, -126}, {-4, -127}, {4, -127}, {13, -126}, {22, -125}, {31, -123},
+    {39, -121}, {48, -118}, {56, -114}, {64, -110}, {71, -105}, {78, -100},
+    {85, -94}, {91, -88}, {97, -82}, {103, -75}, {108, -67}, {112, -60},
+    {116, -52}, {119, -43}, {122, -35}, {124, -26}, {126, -18}, {127, -9}};
 
 /* Function definitions ----------------------------------------------------- */
 
@@ -15,9 +36,9 @@
  * @param y    Y coordinate
  * @return EntityUID Entity UID number
  */
-EntityUID entities_get_uid(EntityType type, uint8_t x, uint8_t y)
+EntityUID entities_get_uid(EntityType type, uint16_t x, uint16_t y)
 {
-    return ((y << LEVEL_WIDTH_BASE) | x) << 4 | type;
+    return (((EntityUID)y << LEVEL_WIDTH_BASE) | x) << 4 | type;
 }
 
 /**
@@ -31,4 +52,56 @@ EntityType entities_get_type(EntityUID uid)
     return uid & 0x0f;
 }
 
+/**
+ * @brief ENTITIES quantize a direction vector into one of the
+ * FIREBALL_DIRECTIONS angles with an integer atan2 approximation.
+ *
+ * NOTE: atan(t) ~ 45 * t + 15.64 * t * (1 - t) degrees in the first octant,
+ * error is below 0.3 degrees.
+ *
+ * @param x X component
+ * @param y Y component
+ * @return uint8_t Direction index, counterclockwise from the X axis
+ */
+uint8_t entities_get_direction(int16_t x, int16_t y)
+{
+    uint16_t abs_x = (x < 0) ? -x : x;
+    uint16_t abs_y = (y < 0) ? -y : y;
+
+    if ((abs_x == 0) && (abs_y == 0))
+        return 0;
+
+    // Tangent in the first octant, fixed point 8 bits
+    uint32_t t = ((uint32_t)MIN(abs_x, abs_y) << 8) / MAX(abs_x, abs_y);
+
+    // Angle in 1/16 degrees
+    int16_t angle = ((45 * 16 * t) >> 8) + ((250 * t * (256 - t)) >> 16);
+
+    if (abs_y > abs_x)
+        angle = 90 * 16 - angle;
+    if (x < 0)
+        angle = 180 * 16 - angle;
+    if (y < 0)
+        angle = 360 * 16 - angle;
+
+    // Round to the closest direction
+    uint8_t step = (360 * 16) / FIREBALL_DIRECTIONS;
+    return ((angle + step / 2) / step) % FIREBALL_DIRECTIONS;
+}
+
+/**
+ * @brief ENTITIES get velocity vector of a given direction.
+ *
+ * @param dir   Direction index
+ * @param speed Speed
+ * @return Coords Velocity vector
+ */
+Coords entities_get_velocity(uint8_t dir, float speed)
+{
+    dir %= FIREBALL_DIRECTIONS;
+
+    return (Coords){entities_direction[dir][0] * speed / INT8_MAX,
+                    entities_direction[dir][1] * speed / INT8_MAX};
+}
+
 /* -------------------------------------------------------------------------- */
\ No newline at end of file
@@ -0,0 +1,110 @@
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "episode.h"
+#include "level.h"
+
+/* Function prototypes ------------------------------------------------------ */
+
+static uint32_t episode_read_u32(const uint8_t *data);
+
+/* Function definitions ----------------------------------------------------- */
+
+/**
+ * @brief EPISODE load episode pack index from binary data, either mapped from
+ * a file or stored in flash.
+ * @details Only the header and the index are checked, levels are validated
+ * when loaded.
+ *
+ * NOTE: Data is referenced and not copied, it must outlive the episode and
+ * its levels.
+ *
+ * @param episode Episode to be loaded
+ * @param data    Episode pack binary data
+ * @param size    Size of data in bytes
+ * @return bool Episode pack index is valid
+ */
+bool episode_load(Episode *episode, const uint8_t *data, uint32_t size)
+{
+    if ((data == NULL) || (size < EPISODE_HEADER_SIZE))
+        return false;
+
+    if ((memcmp(data, EPISODE_MAGIC, 4) != 0) ||
+        (data[4] != EPISODE_VERSION) || (data[5] == 0))
+        return false;
+
+    uint8_t num_levels = data[5];
+    if (size < EPISODE_HEADER_SIZE + (uint32_t)num_levels * EPISODE_INDEX_SIZE)
+        return false;
+
+    // Level data must lie within the pack, offsets are not trusted
+    for (uint8_t i = 0; i < num_levels; i++)
+    {
+        const uint8_t *index = data + EPISODE_HEADER_SIZE +
+                               i * EPISODE_INDEX_SIZE;
+        uint32_t offset = episode_read_u32(index);
+        uint32_t level_size = episode_read_u32(index + 4);
+
+        if ((offset > size) || (level_size > size - offset))
+            return false;
+    }
+
+    episode->data = data;
+    episode->size = size;
+    episode->num_levels = num_levels;
+
+    return true;
+}
+
+/**
+ * @brief EPISODE get level metadata from the episode index.
+ *
+ * @param episode Episode
+ * @param i       Level index
+ * @return EpisodeLevel Level metadata
+ */
+EpisodeLevel episode_get_level(const Episode *episode, uint8_t i)
+{
+    const uint8_t *index = episode->data + EPISODE_HEADER_SIZE +
+                           i * EPISODE_INDEX_SIZE;
+
+    return (EpisodeLevel){
+        .offset = episode_read_u32(index),
+        .size = episode_read_u32(index + 4),
+        .kill_goal = index[8 + EPISODE_NAME_SIZE],
+        .cutscene = index[9 + EPISODE_NAME_SIZE]};
+}
+
+/**
+ * @brief EPISODE load a single level of the episode.
+ *
+ * @param episode Episode
+ * @param i       Level index
+ * @param level   Level to be loaded
+ * @return bool Level data is valid
+ */
+bool episode_load_level(const Episode *episode, uint8_t i, Level *level)
+{
+    if (i >= episode->num_levels)
+        return false;
+
+    EpisodeLevel info = episode_get_level(episode, i);
+
+    return level_load(level, episode->data + info.offset, info.size);
+}
+
+/**
+ * @brief EPISODE read little endian 32-bit value.
+ *
+ * @param data Data pointer
+ * @return uint32_t Value
+ */
+uint32_t episode_read_u32(const uint8_t *data)
+{
+    return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+/* -------------------------------------------------------------------------- */
\ No newline at end of file
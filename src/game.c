@@ -8,13 +8,17 @@
 #include <string.h>
 #include <time.h>
 
+#include "automap.h"
 #include "constants.h"
 #include "coords.h"
 #include "display.h"
 #include "entities.h"
+#include "episode.h"
 #include "input.h"
 #include "level.h"
+#include "navigation.h"
 #include "platform.h"
+#include "profile.h"
 #include "sound.h"
 #include "sprites.h"
 #include "utils.h"
@@ -26,9 +30,7 @@ typedef enum
     SCENE_INTRO,
     SCENE_DIFFICULTY,
     SCENE_MUSIC,
-    SCENE_STORY_INTRO,
-    SCENE_STORY_MID,
-    SCENE_STORY_END,
+    SCENE_STORY,
     SCENE_LEVEL,
     SCENE_SCORE
 } GameScene;
@@ -53,36 +55,47 @@ typedef enum
     DIFFICULTY_VERY_HARD,
 } GameDifficulty;
 
-typedef enum
+typedef struct
 {
-    CUTSCENE_INTRO,
-    CUTSCENE_MID,
-    CUTSCENE_END
-} GameCutscene;
+    const char *name;
+    const uint8_t *data;
+    uint32_t size;
+} GameEpisodeInfo;
 
 /* Function prototypes ------------------------------------------------------ */
 
 /* Level */
-static void game_init_level_scene(const uint8_t level[]);
+static void game_load_episode(void);
+static void game_load_level(uint8_t id);
+static void game_preload_level(void);
+static void game_complete_level(void);
+#ifdef LEVEL_HOT_RELOAD
+static void game_reload_level(void);
+static uint16_t game_remap_spawn(const Level *from, const Level *to,
+                                 uint16_t spawn);
+#endif
+static void game_init_level_scene(const Level *level);
+static void game_update_triggers(const Level *level);
+static void game_run_trigger(const LevelTrigger *trigger);
 
 /* Entities */
-static EntityType game_get_level_entity(const uint8_t level[], int16_t x,
-                                        int16_t y);
 static bool game_is_entity_spawned(EntityUID uid);
-static bool game_is_static_entity_spawned(EntityUID uid);
-static void game_spawn_entity(EntityType type, uint8_t x, uint8_t y);
+static void game_spawn_entity(EntityType type, uint16_t x, uint16_t y,
+                              uint16_t spawn);
 static void game_spawn_fireball(float x, float y);
 static void game_remove_entity(EntityUID uid);
-static void game_remove_static_entity(EntityUID uid);
+static bool game_is_spawn_done(uint16_t spawn);
+static void game_set_spawn_done(uint16_t spawn);
 static void game_remove_dead_enemy(void);
-static void game_update_entities(const uint8_t level[]);
+static uint8_t game_get_update_period(Entity *e);
+static void game_update_entities(const Level *level);
 static void game_sort_entities(void);
 
 /* Game mechanics */
-static EntityUID game_detect_collision(const uint8_t level[], Coords *pos,
+static EntityUID game_detect_collision(const Level *level, Coords *pos,
                                        float rel_x, float rel_y,
                                        bool only_walls);
-static EntityUID game_update_position(const uint8_t level[], Coords *pos,
+static EntityUID game_update_position(const Level *level, Coords *pos,
                                       float rel_x, float rel_y,
                                       bool only_walls);
 static void game_fire_shootgun(void);
@@ -91,8 +104,9 @@ EntityType game_get_item_drop(void);
 
 /* Graphics */
 static Coords game_translate_into_view(Coords *pos);
-static void game_render_map(const uint8_t level[], float view_height);
-static void game_render_entities(float view_height);
+static void game_render_map(const Level *level, float view_height);
+static void game_render_entities(const Level *level, float view_height);
+static void game_render_automap(void);
 static void game_render_gun(uint8_t pos, float jogging, bool fired,
                             uint8_t reload);
 static void game_render_hud(void);
@@ -121,8 +135,7 @@ static uint8_t player_jump_height = 0;
 /* Entities */
 static Entity entity[MAX_ENTITIES];
 static uint8_t num_entities = 0;
-static StaticEntity static_entity[MAX_STATIC_ENTITIES];
-static uint8_t num_static_entities = 0;
+static uint8_t game_spawn_done[MAX_SPAWN_POINTS / 8];
 
 /* Gun */
 static bool gun_fired = false;
@@ -134,20 +147,45 @@ static uint8_t gun_reload_animation = 0;
 /* Display */
 static bool screen_flash = false;
 static uint8_t screen_fade = GRADIENT_COUNT - 1;
+static bool screen_automap = false;
+static bool screen_automap_pressed = false;
 
 /* Game */
 static uint32_t game_button_time = 0;
 static bool game_music_enable = false;
-static GameCutscene game_cutscene = CUTSCENE_INTRO;
+static EpisodeCutscene game_cutscene = CUTSCENE_INTRO;
 static GameDifficulty game_difficulty = DIFFICULTY_EASY;
 static GameText game_hud_text = TEXT_BLANK_SPACE;
-static const uint8_t *game_level = level_e1m1;
 static void (*game_run_scene)(void) = game_run_intro_scene;
 
 static int16_t game_score = 0;
 static uint8_t game_kill_count = 0;
-static uint8_t game_kill_goal = ENEMY_KILL_GOAL1;
+static uint8_t game_kill_goal = 0;
 static bool game_boss_fight = false;
+static uint8_t game_tick = 0;
+
+/* Level */
+static const GameEpisodeInfo game_episode_info = {"e1", episode_e1,
+                                                  sizeof(episode_e1)};
+static Episode game_episode;
+static const uint8_t *game_episode_file = NULL;
+static uint32_t game_episode_file_size = 0;
+static uint8_t game_level_id = 0;
+static EpisodeLevel game_level_info;
+static Level game_level;
+
+/* Next level, preloaded while the story scene plays */
+static Level game_next_level;
+static uint8_t game_next_level_id = 0;
+static uint8_t game_next_chunk = 0;
+static bool game_next_level_ready = false;
+
+/* Triggers of the player tile */
+static uint16_t game_trigger[LEVEL_MAX_TILE_TRIGGERS];
+static uint8_t game_num_triggers = 0;
+static int16_t game_trigger_x = -1;
+static int16_t game_trigger_y = -1;
+static uint8_t game_trigger_kills = 0;
 
 static uint8_t enemy_melee_damage = ENEMY_MELEE_DAMAGE_EASY;
 static uint8_t enemy_fireball_damage = ENEMY_FIREBALL_DAMAGE_EASY;
@@ -157,12 +195,221 @@ static uint8_t ammo_pickup_value = AMMO_PICKUP_EASY;
 
 /* Function definitions ----------------------------------------------------- */
 
+/**
+ * @brief GAME load episode pack index, from an episode file if the platform
+ * can map it, otherwise from the built-in episode. Levels are loaded lazily.
+ *
+ */
+void game_load_episode(void)
+{
+    char path[32];
+    uint32_t size = 0;
+    snprintf(path, sizeof(path), EPISODE_PATH_FORMAT, game_episode_info.name);
+
+    const uint8_t *data = platform_map_file(path, &size);
+    if (data != NULL)
+    {
+        if (episode_load(&game_episode, data, size))
+        {
+            game_episode_file = data;
+            game_episode_file_size = size;
+            return;
+        }
+
+        // Invalid episode file, fallback to built-in episode
+        platform_unmap_file(data, size);
+    }
+
+    episode_load(&game_episode, game_episode_info.data, game_episode_info.size);
+}
+
+/**
+ * @brief GAME load a level of the episode and its metadata.
+ *
+ * @param id Level index in the episode
+ */
+void game_load_level(uint8_t id)
+{
+    game_level_info = episode_get_level(&game_episode, id);
+
+    // Preloaded while the story scene played, its first chunks are cached
+    if (game_next_level_ready && (game_next_level_id == id))
+    {
+        game_level = game_next_level;
+        game_next_level_ready = false;
+        return;
+    }
+
+    if (episode_load_level(&game_episode, id, &game_level))
+        return;
+
+    // Invalid level in the episode file, fallback to built-in episode
+    if (game_episode_file != NULL)
+    {
+        platform_unmap_file(game_episode_file, game_episode_file_size);
+        game_episode_file = NULL;
+    }
+
+    episode_load(&game_episode, game_episode_info.data, game_episode_info.size);
+    if (id >= game_episode.num_levels)
+        game_level_id = id = 0;
+
+    game_level_info = episode_get_level(&game_episode, id);
+    episode_load_level(&game_episode, id, &game_level);
+}
+
+/**
+ * @brief GAME preload the next level while the story scene plays, then the
+ * map chunks around its player spawn, one per frame.
+ *
+ */
+void game_preload_level(void)
+{
+    // Episode completed, the score scene comes next
+    if (game_level_id >= game_episode.num_levels)
+        return;
+
+    if (!game_next_level_ready || (game_next_level_id != game_level_id))
+    {
+        game_next_level_ready = episode_load_level(&game_episode, game_level_id,
+                                                   &game_next_level);
+        game_next_level_id = game_level_id;
+        game_next_chunk = 0;
+        return;
+    }
+
+    // 3x3 chunks around the spawn cover the render range
+    if (game_next_chunk < 9)
+    {
+        LevelSpawn spawn = level_get_spawn(&game_next_level,
+                                           game_next_level.player);
+        level_prefetch(&game_next_level,
+                       spawn.x + (game_next_chunk % 3 - 1) * LEVEL_CHUNK_SIZE,
+                       spawn.y + (game_next_chunk / 3 - 1) * LEVEL_CHUNK_SIZE);
+        game_next_chunk++;
+    }
+}
+
+/**
+ * @brief GAME complete current level, its cutscene is shown before the next
+ * level or the score when the episode is completed.
+ *
+ */
+void game_complete_level(void)
+{
+    game_cutscene = game_level_info.cutscene;
+    game_level_id++;
+    game_jump_to_scene(SCENE_STORY);
+}
+
+#ifdef LEVEL_HOT_RELOAD
+/**
+ * @brief GAME swap in the current level from the episode file when it changes
+ * on disk, keeping the player pose and live entities.
+ *
+ */
+void game_reload_level(void)
+{
+    char path[32];
+    snprintf(path, sizeof(path), EPISODE_PATH_FORMAT, game_episode_info.name);
+
+    if (!platform_file_changed(path))
+        return;
+
+    uint32_t t0 = platform_micros();
+    uint32_t size = 0;
+    const uint8_t *data = platform_map_file(path, &size);
+    Episode episode;
+    Level level;
+
+    // Keep playing the current level if the new one is broken
+    if ((data == NULL) || !episode_load(&episode, data, size) ||
+        !episode_load_level(&episode, game_level_id, &level))
+    {
+        printf("Level %s is invalid, reload skipped\n", path);
+        if (data != NULL)
+            platform_unmap_file(data, size);
+        return;
+    }
+
+    // Spawn indices change when spawns are added or removed, so consumed
+    // spawns and live entities are matched by tile while both levels are
+    // still mapped
+    uint8_t spawn_done[MAX_SPAWN_POINTS / 8] = {0};
+    for (uint16_t i = 0; i < game_level.num_spawns; i++)
+    {
+        if (!game_is_spawn_done(i))
+            continue;
+
+        uint16_t spawn = game_remap_spawn(&game_level, &level, i);
+        if (spawn < MAX_SPAWN_POINTS)
+            spawn_done[spawn / 8] |= BIT_MASK[spawn % 8];
+    }
+    memcpy(game_spawn_done, spawn_done, sizeof(game_spawn_done));
+
+    for (uint8_t i = 0; i < num_entities; i++)
+        entity[i].spawn = game_remap_spawn(&game_level, &level,
+                                           entity[i].spawn);
+
+    // Explored map is kept unless the downsampling may change
+    if ((level.width != game_level.width) ||
+        (level.height != game_level.height))
+        automap_init(&level);
+
+    if (game_episode_file != NULL)
+        platform_unmap_file(game_episode_file, game_episode_file_size);
+    game_episode = episode;
+    game_episode_file = data;
+    game_episode_file_size = size;
+    game_level_info = episode_get_level(&game_episode, game_level_id);
+    game_level = level;
+    game_next_level_ready = false;
+
+    // Chunk cache is flushed by level_load, the flow field and line of sight
+    // are rebuilt on the next entities update
+    navigation_init();
+
+    // Refresh triggers of the player tile without firing them again
+    game_num_triggers = 0;
+    if (game_trigger_x >= 0)
+        game_num_triggers = level_find_triggers(&game_level, game_trigger_x,
+                                                game_trigger_y, game_trigger,
+                                                LEVEL_MAX_TILE_TRIGGERS);
+
+    printf("Level %s reloaded in %u us\n", path,
+           (unsigned int)(platform_micros() - t0));
+}
+
+/**
+ * @brief GAME find the spawn point of a level at the same tile and with the
+ * same entity type as a spawn point of another level.
+ *
+ * @param from  Level of the spawn point
+ * @param to    Level to search
+ * @param spawn Spawn point index in the first level
+ * @return uint16_t Spawn point index in the second level, SPAWN_NULL if none
+ */
+uint16_t game_remap_spawn(const Level *from, const Level *to, uint16_t spawn)
+{
+    if (spawn >= from->num_spawns)
+        return SPAWN_NULL;
+
+    LevelSpawn old_spawn = level_get_spawn(from, spawn);
+    uint16_t new_index = level_find_spawn(to, old_spawn.x, old_spawn.y);
+    if ((new_index == SPAWN_NULL) ||
+        (level_get_spawn(to, new_index).type != old_spawn.type))
+        return SPAWN_NULL;
+
+    return new_index;
+}
+#endif
+
 /**
  * @brief GAME initialize level state.
  *
- * @param level Level byte map
+ * @param level Level
  */
-void game_init_level_scene(const uint8_t level[])
+void game_init_level_scene(const Level *level)
 {
     /* Player */
     player_walk_sound = false;
@@ -174,8 +421,7 @@ void game_init_level_scene(const uint8_t level[])
     /* Entities */
     memset(entity, 0x00, sizeof(Entity) * MAX_ENTITIES);
     num_entities = 0;
-    memset(static_entity, 0x00, sizeof(StaticEntity) * MAX_STATIC_ENTITIES);
-    num_static_entities = 0;
+    memset(game_spawn_done, 0x00, sizeof(game_spawn_done));
 
     /* Gun */
     gun_position = 0;
@@ -186,47 +432,111 @@ void game_init_level_scene(const uint8_t level[])
 
     /* Game */
     game_kill_count = 0;
+    game_kill_goal = game_level_info.kill_goal;
     game_boss_fight = false;
-    if (game_level == level_e1m1)
-        game_hud_text = TEXT_GOAL_KILLS;
-    else if ((game_level == level_e1m2) && (!game_boss_fight))
-        game_hud_text = TEXT_GOAL_FIND_EXIT;
+    game_hud_text = (game_kill_goal > 0) ? TEXT_GOAL_KILLS
+                                         : TEXT_GOAL_FIND_EXIT;
+
+    // Flow field is rebuilt on the next entities update
+    navigation_init();
+    automap_init(level);
+
+    // Triggers of the player tile are looked up on the next update
+    game_num_triggers = 0;
+    game_trigger_x = -1;
+    game_trigger_y = -1;
+    game_trigger_kills = 0;
+
+    // Player spawn index is precomputed by the level compiler, other
+    // entities are spawned when seen by the raycaster
+    LevelSpawn spawn = level_get_spawn(level, level->player);
+    player = entities_create_player(spawn.x, spawn.y);
+}
+
+/**
+ * @brief GAME run level triggers, only when the player moves to another tile
+ * or the kill count changes.
+ *
+ * @param level Level
+ */
+void game_update_triggers(const Level *level)
+{
+    int16_t x = player.pos.x;
+    int16_t y = player.pos.y;
 
-    // Find player in the map and create instance
-    for (int16_t y = LEVEL_HEIGHT - 1; y >= 0; y--)
+    // Triggers of a tile are looked up once, when the player enters it
+    if ((x != game_trigger_x) || (y != game_trigger_y))
     {
-        for (uint8_t x = 0; x < LEVEL_WIDTH; x++)
+        game_trigger_x = x;
+        game_trigger_y = y;
+        game_num_triggers = level_find_triggers(level, x, y, game_trigger,
+                                                LEVEL_MAX_TILE_TRIGGERS);
+
+        for (uint8_t i = 0; i < game_num_triggers; i++)
         {
-            uint8_t block = game_get_level_entity(level, x, y);
-            if (block == E_PLAYER)
-            {
-                player = entities_create_player(x, y);
-                return;
-            }
+            LevelTrigger trigger = level_get_trigger(level, game_trigger[i]);
+            if (trigger.kills == 0)
+                game_run_trigger(&trigger);
+        }
+    }
+
+    // Kill count may have skipped values if several enemies died at once
+    if (game_kill_count != game_trigger_kills)
+    {
+        uint8_t kills = game_trigger_kills;
+        game_trigger_kills = game_kill_count;
 
-            /** TODO: Create other static entities */
+        for (uint8_t i = 0; i < game_num_triggers; i++)
+        {
+            LevelTrigger trigger = level_get_trigger(level, game_trigger[i]);
+            if ((trigger.kills > kills) && (trigger.kills <= game_kill_count))
+                game_run_trigger(&trigger);
         }
     }
 }
 
 /**
- * @brief GAME get entity type from level byte map.
+ * @brief GAME run a level trigger action.
  *
- * @param level Level byte map
- * @param x     X coordinate
- * @param y     Y coordinate
- * @return EntityType Entity type
+ * @param trigger Trigger
  */
-EntityType game_get_level_entity(const uint8_t level[], int16_t x, int16_t y)
+void game_run_trigger(const LevelTrigger *trigger)
 {
-    if ((x < 0) || (x >= LEVEL_WIDTH) || (y < 0) || (y >= LEVEL_HEIGHT))
-        return E_FLOOR;
+    switch (trigger->action)
+    {
+    case TRIGGER_SPAWN:
+        game_spawn_entity(trigger->param, trigger->x, trigger->y, SPAWN_NULL);
+        break;
+
+    case TRIGGER_TELEPORT:
+        if (trigger->param)
+        {
+            player.pos.x += (int16_t)trigger->x;
+            player.pos.y += (int16_t)trigger->y;
+        }
+        else
+        {
+            player.pos.x = trigger->x + 0.5f;
+            player.pos.y = trigger->y + 0.5f;
+        }
+        break;
 
-    // Y is read in inverse order
-    uint8_t byte = level[((LEVEL_HEIGHT - 1 - y) * LEVEL_WIDTH + x) / 2];
-    byte >>= (x % 2) ? 0 : 4;
+    case TRIGGER_BOSS:
+        game_kill_count = 0;
+        game_trigger_kills = 0;
+        game_kill_goal = trigger->param;
+        game_boss_fight = true;
+        break;
+
+    case TRIGGER_EXIT:
+        sound_play_pattern(mus_s1_pat, MUS_S1_SND_PRIORITY, false,
+                           game_music_enable);
+        game_complete_level();
+        break;
 
-    return byte & 0x0f;
+    default:
+        break;
+    }
 }
 
 /**
@@ -246,58 +556,45 @@ bool game_is_entity_spawned(EntityUID uid)
     return false;
 }
 
-/**
- * @brief GAME check if a static entity with given UID is already spawned.
- *
- * @param uid Entity UID number
- * @return bool Static entity is spawned
- */
-bool game_is_static_entity_spawned(EntityUID uid)
-{
-    for (uint8_t i = 0; i < num_static_entities; i++)
-    {
-        if (static_entity[i].uid == uid)
-            return true;
-    }
-
-    return false;
-}
-
 /**
  * @brief GAME spawn a new entity at a given location.
  *
- * @param type Entity type
- * @param x    X coordinate
- * @param y    Y coordinate
+ * @param type  Entity type
+ * @param x     X coordinate
+ * @param y     Y coordinate
+ * @param spawn Level spawn point index, SPAWN_NULL if not from one
  */
-void game_spawn_entity(EntityType type, uint8_t x, uint8_t y)
+void game_spawn_entity(EntityType type, uint16_t x, uint16_t y,
+                       uint16_t spawn)
 {
     // Limit the number of spawned entities
     if (num_entities >= MAX_ENTITIES)
         return;
 
-    /** TODO: Read static entity status */
+    // Items already picked up and enemies already killed stay so
+    if (game_is_spawn_done(spawn))
+        return;
 
     switch (type)
     {
     case E_ENEMY:
         entity[num_entities] = entities_create_enemy(x, y);
-        num_entities++;
         break;
 
     case E_AMMO:
         entity[num_entities] = entities_create_key(x, y);
-        num_entities++;
         break;
 
     case E_MEDKIT:
         entity[num_entities] = entities_create_medkit(x, y);
-        num_entities++;
         break;
 
     default:
-        break;
+        return;
     }
+
+    entity[num_entities].spawn = spawn;
+    num_entities++;
 }
 
 /**
@@ -314,16 +611,13 @@ void game_spawn_fireball(float x, float y)
 
     // Remove if already exists, don't throw anything
     // Not the best, but shouldn't happen too often
-    EntityUID uid = entities_get_uid(E_FIREBALL, (uint8_t)x, (uint8_t)y);
+    EntityUID uid = entities_get_uid(E_FIREBALL, (uint16_t)x, (uint16_t)y);
     if (game_is_entity_spawned(uid))
         return;
 
-    // Calculate direction. 32 angles
-    int16_t dir = ((atan2f(y - player.pos.y, x - player.pos.x) / PI) + 1) *
-                  FIREBALL_ANGLES;
-
-    if (dir < 0)
-        dir += FIREBALL_ANGLES * 2;
+    // Calculate direction towards the player, velocity is set once here
+    uint8_t dir = entities_get_direction((player.pos.x - x) * 64,
+                                         (player.pos.y - y) * 64);
 
     entity[num_entities] = entities_create_fireball(x, y, dir);
     num_entities++;
@@ -355,28 +649,33 @@ void game_remove_entity(EntityUID uid)
 }
 
 /**
- * @brief GAME remove a static entity.
+ * @brief GAME check if a level spawn point was consumed or killed.
  *
- * @param uid Entity UID number
+ * @param spawn Level spawn point index
+ * @return bool Spawn point is done
  */
-void game_remove_static_entity(EntityUID uid)
+bool game_is_spawn_done(uint16_t spawn)
 {
-    uint8_t i = 0;
-    bool found = false;
+    // Levels have at most MAX_SPAWN_POINTS spawns, this is SPAWN_NULL
+    if (spawn >= MAX_SPAWN_POINTS)
+        return false;
 
-    while (i < num_static_entities)
-    {
-        if ((!found) && (static_entity[i].uid == uid))
-        {
-            found = true;
-            num_static_entities--;
-        }
+    return READ_BIT(game_spawn_done[spawn / 8], spawn % 8);
+}
 
-        if (found)
-            static_entity[i] = static_entity[i + 1];
+/**
+ * @brief GAME mark a level spawn point as consumed or killed, so it is not
+ * spawned again after the entity is evicted.
+ *
+ * @param spawn Level spawn point index
+ */
+void game_set_spawn_done(uint16_t spawn)
+{
+    // Levels have at most MAX_SPAWN_POINTS spawns, this is SPAWN_NULL
+    if (spawn >= MAX_SPAWN_POINTS)
+        return;
 
-        i++;
-    }
+    game_spawn_done[spawn / 8] |= BIT_MASK[spawn % 8];
 }
 
 /**
@@ -398,30 +697,57 @@ void game_remove_dead_enemy(void)
     }
 }
 
+/**
+ * @brief GAME get how many ticks pass between two updates of an entity.
+ * @details Entities the player can't interact with are updated less often,
+ * fireballs and dying enemies are always updated. Enemies only move within
+ * MAX_ENEMY_VIEW, where they are updated every tick, so only idle enemies and
+ * items are thinned and only timers need to be scaled by the period.
+ *
+ * @param e Entity
+ * @return uint8_t Update period in ticks
+ */
+uint8_t game_get_update_period(Entity *e)
+{
+    EntityType type = entities_get_type(e->uid);
+
+    if ((type == E_FIREBALL) || ((e->health == 0) && (e->drop_item)))
+        return 1;
+    if (e->distance_sq > ENTITY_LOD_FAR_DIST_SQ)
+        return ENTITY_LOD_FAR_PERIOD;
+    if (e->distance_sq > ENTITY_LOD_MID_DIST_SQ)
+        return ENTITY_LOD_MID_PERIOD;
+
+    return 1;
+}
+
 /**
  * @brief GAME execute entities AI logic.
  *
- * @param level Level byte map
+ * @param level Level
  */
-void game_update_entities(const uint8_t level[])
+void game_update_entities(const Level *level)
 {
+    // Enemies steer towards the player through the flow field, and only
+    // become aware of the player if there is a line of sight
+    navigation_update(level, &(player.pos));
+    navigation_update_visibility(level, entity, num_entities);
+
+    game_tick++;
+
     uint8_t i = 0;
     while (i < num_entities)
     {
         // Update distance
-        entity[i].distance = coords_get_distance(&(player.pos),
-                                                 &(entity[i].pos));
-
-        // Run the timer. Works with actual frames.
-        if (entity[i].timer > 0)
-            entity[i].timer--;
+        entity[i].distance_sq = coords_get_distance_sq(&(player.pos),
+                                                       &(entity[i].pos));
 
         // Keep dead entities number under control
         if (num_entities > MAX_ENTITIES)
             game_remove_dead_enemy();
 
         // Too far away. put it in doze mode
-        if (entity[i].distance > MAX_ENTITY_DISTANCE)
+        if (entity[i].distance_sq > MAX_ENTITY_DISTANCE_SQ)
         {
             game_remove_entity(entity[i].uid);
             // Don't increase 'i', since current one has been removed
@@ -435,6 +761,22 @@ void game_update_entities(const uint8_t level[])
             continue;
         }
 
+        // Level of detail, far entities are updated every few ticks. Spread
+        // them over ticks by position, it doesn't change when sorting.
+        uint8_t period = game_get_update_period(&(entity[i]));
+        if ((game_tick + (entity[i].uid >> 4)) & (period - 1))
+        {
+            profile_add(PROFILE_ENTITIES_SKIPPED, 1);
+            i++;
+            continue;
+        }
+
+        profile_add(PROFILE_ENTITIES_UPDATED, 1);
+
+        // Run the timer. Works with actual frames, scaled by update period.
+        entity[i].timer = (entity[i].timer > period) ?
+                              (entity[i].timer - period) : 0;
+
         switch (entities_get_type(entity[i].uid))
         {
         case E_ENEMY:
@@ -444,16 +786,18 @@ void game_update_entities(const uint8_t level[])
             {
                 if (entity[i].state != S_DEAD)
                 {
-                    if (game_level == level_e1m1)
+                    if (game_level_info.kill_goal > 0)
                         game_hud_text = TEXT_GOAL_KILLS;
                     entity[i].state = S_DEAD;
                     entity[i].timer = 6;
+                    game_set_spawn_done(entity[i].spawn);
                 }
 
                 if (entity[i].drop_item == true)
                 {
                     EntityType item = game_get_item_drop();
-                    game_spawn_entity(item, entity[i].pos.x, entity[i].pos.y);
+                    game_spawn_entity(item, entity[i].pos.x, entity[i].pos.y,
+                                      SPAWN_NULL);
 
                     entity[i].drop_item = false;
                     game_kill_count++;
@@ -477,8 +821,9 @@ void game_update_entities(const uint8_t level[])
             }
             else
             {
-                if ((entity[i].distance > ENEMY_MELEE_DIST) &&
-                    (entity[i].distance < MAX_ENEMY_VIEW))
+                if ((entity[i].distance_sq > ENEMY_MELEE_DIST_SQ) &&
+                    (entity[i].distance_sq < MAX_ENEMY_VIEW_SQ) &&
+                    (entity[i].visible || (entity[i].state == S_ALERT)))
                 {
                     if (entity[i].state != S_ALERT)
                     {
@@ -487,7 +832,8 @@ void game_update_entities(const uint8_t level[])
                     }
                     else
                     {
-                        if (entity[i].timer == 0)
+                        // Don't throw fireballs through walls, keep chasing
+                        if ((entity[i].timer == 0) && (entity[i].visible))
                         {
                             // Throw a fireball
                             game_spawn_fireball(
@@ -497,19 +843,26 @@ void game_update_entities(const uint8_t level[])
                         }
                         else
                         {
-                            // Move towards to the player
+                            // Move towards to the player, straight when
+                            // sharing the tile or out of the flow field
+                            Coords dir;
+                            if (!navigation_get_direction(&(entity[i].pos),
+                                                          &dir))
+                            {
+                                dir.x = SIGN(player.pos.x, entity[i].pos.x);
+                                dir.y = SIGN(player.pos.y, entity[i].pos.y);
+                            }
+
                             game_update_position(
                                 level,
                                 &(entity[i].pos),
-                                (SIGN(player.pos.x, entity[i].pos.x) *
-                                 ENEMY_SPEED * delta_time),
-                                (SIGN(player.pos.y, entity[i].pos.y) *
-                                 ENEMY_SPEED * delta_time),
+                                dir.x * ENEMY_SPEED * delta_time,
+                                dir.y * ENEMY_SPEED * delta_time,
                                 true);
                         }
                     }
                 }
-                else if (entity[i].distance <= ENEMY_MELEE_DIST)
+                else if (entity[i].distance_sq <= ENEMY_MELEE_DIST_SQ)
                 {
                     if (entity[i].state != S_MELEE)
                     {
@@ -534,7 +887,7 @@ void game_update_entities(const uint8_t level[])
 
         case E_FIREBALL:
         {
-            if (entity[i].distance < FIREBALL_COLLIDER_DIST)
+            if (entity[i].distance_sq < FIREBALL_COLLIDER_DIST_SQ)
             {
                 // Hit the player and disappear
                 player.health = MAX(0, player.health - enemy_fireball_damage);
@@ -545,14 +898,11 @@ void game_update_entities(const uint8_t level[])
             else
             {
                 // Move. Only collide with walls.
-                // Note: using health to store the angle of the movement
                 EntityUID collided = game_update_position(
                     level,
                     &(entity[i].pos),
-                    (cosf(entity[i].health / FIREBALL_ANGLES * PI) *
-                     FIREBALL_SPEED),
-                    (sinf(entity[i].health / FIREBALL_ANGLES * PI) *
-                     FIREBALL_SPEED),
+                    entity[i].velocity.x,
+                    entity[i].velocity.y,
                     true);
 
                 if (collided)
@@ -566,34 +916,43 @@ void game_update_entities(const uint8_t level[])
 
         case E_MEDKIT:
         {
-            if ((entity[i].distance < ITEM_COLLIDER_DIST) &&
+            if ((entity[i].distance_sq < ITEM_COLLIDER_DIST_SQ) &&
                 (player.health != PLAYER_MAX_HEALTH) &&
                 (player_jump_height < 14))
             {
                 // Pickup
-                sound_play(medkit_snd, MEDKIT_SND_LEN, game_music_enable);
-                entity[i].state = S_HIDDEN;
+                sound_play(medkit_snd, MEDKIT_SND_LEN, MEDKIT_SND_PRIORITY,
+                           game_music_enable);
 
                 player.health = MIN(
                     PLAYER_MAX_HEALTH, player.health + medkit_heal_value);
                 screen_flash = true;
                 game_hud_text = TEXT_FOUND_MEDKIT;
+
+                // Consumed for good, no need to keep it around hidden
+                game_set_spawn_done(entity[i].spawn);
+                game_remove_entity(entity[i].uid);
+                continue;
             }
             break;
         }
 
         case E_AMMO:
         {
-            if ((entity[i].distance < ITEM_COLLIDER_DIST) &&
+            if ((entity[i].distance_sq < ITEM_COLLIDER_DIST_SQ) &&
                 (player.ammo < PLAYER_MAX_AMMO) &&
                 (player_jump_height < 14))
             {
                 // Pickup
-                sound_play(get_key_snd, GET_KEY_SND_LEN, game_music_enable);
-                entity[i].state = S_HIDDEN;
+                sound_play(get_key_snd, GET_KEY_SND_LEN, GET_KEY_SND_PRIORITY,
+                           game_music_enable);
                 player.ammo = MIN(
                     PLAYER_MAX_AMMO, player.ammo + ammo_pickup_value);
                 game_hud_text = TEXT_FOUND_AMMO;
+
+                game_set_spawn_done(entity[i].spawn);
+                game_remove_entity(entity[i].uid);
+                continue;
             }
             break;
         }
@@ -627,7 +986,8 @@ void game_sort_entities(void)
         for (uint8_t i = 0; i < num_entities - gap; i++)
         {
             uint8_t j = i + gap;
-            if (entity[i].distance < entity[j].distance)
+            // Squared distance keeps the same ordering, no sqrt needed
+            if (entity[i].distance_sq < entity[j].distance_sq)
             {
                 SWAP(entity[i], entity[j]);
                 swapped = true;
@@ -639,43 +999,44 @@ void game_sort_entities(void)
 /**
  * @brief GAME detect collision between entities and level blocks.
  *
- * @param level      Level byte map
+ * @param level      Level
  * @param pos        Position to be checked
  * @param rel_x      X relative direction
  * @param rel_y      Y relative direction
  * @param only_walls Check only walls collisions
  * @return EntityUID Entity UID number
  */
-EntityUID game_detect_collision(const uint8_t level[], Coords *pos,
+EntityUID game_detect_collision(const Level *level, Coords *pos,
                                 float rel_x, float rel_y, bool only_walls)
 {
     // Wall collision
-    uint8_t round_x = pos->x + rel_x;
-    uint8_t round_y = pos->y + rel_y;
-    uint8_t block = game_get_level_entity(level, round_x, round_y);
+    int16_t round_x = pos->x + rel_x;
+    int16_t round_y = pos->y + rel_y;
+    uint8_t block = level_get_entity(level, round_x, round_y);
 
     if (block == E_WALL)
     {
-        sound_play(hit_wall_snd, HIT_WALL_SND_LEN, game_music_enable);
+        sound_play(hit_wall_snd, HIT_WALL_SND_LEN, HIT_WALL_SND_PRIORITY,
+                   game_music_enable);
         return entities_get_uid(block, round_x, round_y);
     }
     else if ((block == E_DOOR) && (player.secret == false))
     {
         player.secret = true;
         game_hud_text = TEXT_FOUND_SECRET;
-        sound_play(s_snd, S_SND_LEN, game_music_enable);
+        sound_play(s_snd, S_SND_LEN, S_SND_PRIORITY, game_music_enable);
     }
     else if ((block == E_DOOR2) && (player.secret2 == false))
     {
         player.secret2 = true;
         game_hud_text = TEXT_FOUND_SECRET;
-        sound_play(s_snd, S_SND_LEN, game_music_enable);
+        sound_play(s_snd, S_SND_LEN, S_SND_PRIORITY, game_music_enable);
     }
     else if ((block == E_DOOR3) && (player.secret3 == false))
     {
         player.secret3 = true;
         game_hud_text = TEXT_FOUND_SECRET;
-        sound_play(s_snd, S_SND_LEN, game_music_enable);
+        sound_play(s_snd, S_SND_LEN, S_SND_PRIORITY, game_music_enable);
     }
 
     if (only_walls)
@@ -697,11 +1058,11 @@ EntityUID game_detect_collision(const uint8_t level[], Coords *pos,
             continue;
 
         Coords new_coords = {entity[i].pos.x - rel_x, entity[i].pos.y - rel_y};
-        uint8_t distance = coords_get_distance(pos, &new_coords);
+        uint16_t distance_sq = coords_get_distance_sq(pos, &new_coords);
 
         // Check distance and if it's getting closer
-        if ((distance < ENEMY_COLLIDER_DIST) &&
-            (distance < entity[i].distance))
+        if ((distance_sq < ENEMY_COLLIDER_DIST_SQ) &&
+            (distance_sq < entity[i].distance_sq))
             return entity[i].uid;
     }
 
@@ -711,14 +1072,14 @@ EntityUID game_detect_collision(const uint8_t level[], Coords *pos,
 /**
  * @brief GAME update position if possible, otherwise return collided uid.
  *
- * @param level      Level byte map
+ * @param level      Level
  * @param pos        Position to be checked
  * @param rel_x      X relative direction
  * @param rel_y      Y relative direction
  * @param only_walls Check only walls collisions
  * @return EntityUID Entity UID number
  */
-EntityUID game_update_position(const uint8_t level[], Coords *pos, float rel_x,
+EntityUID game_update_position(const Level *level, Coords *pos, float rel_x,
                                float rel_y, bool only_walls)
 {
     EntityUID collide_x = game_detect_collision(
@@ -740,7 +1101,7 @@ EntityUID game_update_position(const uint8_t level[], Coords *pos, float rel_x,
  */
 void game_fire_shootgun(void)
 {
-    sound_play(shoot_snd, SHOOT_SND_LEN, game_music_enable);
+    sound_play(shoot_snd, SHOOT_SND_LEN, SHOOT_SND_PRIORITY, game_music_enable);
     for (uint8_t i = 0; i < num_entities; i++)
     {
         // Shoot only ALIVE enemies
@@ -753,10 +1114,12 @@ void game_fire_shootgun(void)
         if ((fabsf(transform.x) < 20.0f) && (transform.y > 0.0f))
         {
             // Damage decrease with distance
+            uint8_t distance = coords_get_distance(&(player.pos),
+                                                   &(entity[i].pos));
             uint8_t damage = MIN(
                 player_max_damage,
                 (player_max_damage /
-                 (fabsf(transform.x) * entity[i].distance) / 5.0f));
+                 (fabsf(transform.x) * distance) / 5.0f));
 
             entity[i].health = MAX(0, entity[i].health - damage);
             entity[i].state = S_HIT;
@@ -771,10 +1134,10 @@ void game_fire_shootgun(void)
  */
 void game_melee_attack(void)
 {
-    sound_play(melee_snd, MELEE_SND_LEN, game_music_enable);
+    sound_play(melee_snd, MELEE_SND_LEN, MELEE_SND_PRIORITY, game_music_enable);
     for (uint8_t i = 0; i < num_entities; i++)
     {
-        if (entity[i].distance <= ENEMY_MELEE_DIST)
+        if (entity[i].distance_sq <= ENEMY_MELEE_DIST_SQ)
         {
             // Attack only ALIVE enemies
             if ((entities_get_type(entity[i].uid) != E_ENEMY) ||
@@ -786,10 +1149,12 @@ void game_melee_attack(void)
             if ((fabsf(transform.x) < 20.0f) && (transform.y > 0.0f))
             {
                 // Damage decrease with distance
+                uint8_t distance = coords_get_distance(&(player.pos),
+                                                       &(entity[i].pos));
                 uint8_t damage = MIN(
                     player_max_damage,
                     (player_max_damage /
-                     (fabsf(transform.x) * entity[i].distance) / 5.0f));
+                     (fabsf(transform.x) * distance) / 5.0f));
 
                 entity[i].health = MAX(0, entity[i].health - damage);
                 entity[i].state = S_HIT;
@@ -847,10 +1212,10 @@ Coords game_translate_into_view(Coords *pos)
  * @brief GAME render map with raycasting technique.
  * NOTE: Based on https://lodev.org/cgtutor/raycasting.html
  *
- * @param level       Level byte map
+ * @param level       Level
  * @param view_height View height of the camera
  */
-void game_render_map(const uint8_t level[], float view_height)
+void game_render_map(const Level *level, float view_height)
 {
     EntityUID last_uid = UID_NULL;
 
@@ -859,9 +1224,8 @@ void game_render_map(const uint8_t level[], float view_height)
         float camera_x = 2.0f * (float)x / SCREEN_WIDTH - 1.0f;
         float ray_x = player.dir.x + player.plane.x * camera_x;
         float ray_y = player.dir.y + player.plane.y * camera_x;
-        uint8_t map_x = (uint8_t)(player.pos.x);
-        uint8_t map_y = (uint8_t)(player.pos.y);
-        Coords map_coords = {player.pos.x, player.pos.y};
+        int16_t map_x = (int16_t)(player.pos.x);
+        int16_t map_y = (int16_t)(player.pos.y);
         float delta_x = fabsf(1.0f / ray_x);
         float delta_y = fabsf(1.0f / ray_y);
 
@@ -912,7 +1276,7 @@ void game_render_map(const uint8_t level[], float view_height)
                 is_side_wall = true;
             }
 
-            uint8_t block = game_get_level_entity(level, map_x, map_y);
+            uint8_t block = level_get_entity(level, map_x, map_y);
             if ((block == E_WALL) || (block == E_DOOR) || (block == E_DOOR2) ||
                 (block == E_DOOR3) || (block == E_COLL))
             {
@@ -928,13 +1292,16 @@ void game_render_map(const uint8_t level[], float view_height)
                 if ((block == E_ENEMY) || (block & 0b00001000))
                 {
                     // Check that it's close to the player
-                    if (coords_get_distance(&(player.pos), &map_coords) <
-                        MAX_ENTITY_DISTANCE)
+                    Coords map_coords = {map_x + 0.5f, map_y + 0.5f};
+                    if (coords_get_distance_sq(&(player.pos), &map_coords) <
+                        MAX_ENTITY_DISTANCE_SQ)
                     {
                         EntityUID uid = entities_get_uid(block, map_x, map_y);
                         if (last_uid != uid && !game_is_entity_spawned(uid))
                         {
-                            game_spawn_entity(block, map_x, map_y);
+                            game_spawn_entity(
+                                block, map_x, map_y,
+                                level_find_spawn(level, map_x, map_y));
                             last_uid = uid;
                         }
                     }
@@ -946,6 +1313,8 @@ void game_render_map(const uint8_t level[], float view_height)
 
         if (hit_wall)
         {
+            automap_reveal(map_x, map_y);
+
             float distance;
             if (is_side_wall)
                 distance = MAX(
@@ -975,9 +1344,10 @@ void game_render_map(const uint8_t level[], float view_height)
 /**
  * @brief GAME render entities sprites.
  *
+ * @param level       Level
  * @param view_height View height of the camera
  */
-void game_render_entities(float view_height)
+void game_render_entities(const Level *level, float view_height)
 {
     game_sort_entities();
 
@@ -986,6 +1356,14 @@ void game_render_entities(float view_height)
         if (entity[i].state == S_HIDDEN)
             continue;
 
+        // Cull entities hidden by walls before transform
+        if (!level_is_potentially_visible(level, player.pos.x, player.pos.y,
+                                          entity[i].pos.x, entity[i].pos.y))
+        {
+            profile_add(PROFILE_ENTITIES_CULLED, 1);
+            continue;
+        }
+
         Coords transform = game_translate_into_view(&(entity[i].pos));
 
         // don´t render if behind the player or too far away
@@ -1010,7 +1388,7 @@ void game_render_entities(float view_height)
         {
             uint8_t sprite;
             if (entity[i].state == S_ALERT)
-                sprite = (millis() / 500) % 2; // Walking
+                sprite = (anim_time / ENEMY_WALK_FRAME_US) % 2; // Walking
             else if (entity[i].state == S_FIRING)
                 sprite = 2; // Fireball
             else if (entity[i].state == S_HIT)
@@ -1081,6 +1459,25 @@ void game_render_entities(float view_height)
     }
 }
 
+/**
+ * @brief GAME render automap with enemy and player markers over the
+ * raycasting area.
+ *
+ */
+void game_render_automap(void)
+{
+    automap_draw();
+
+    for (uint8_t i = 0; i < num_entities; i++)
+    {
+        if ((entities_get_type(entity[i].uid) == E_ENEMY) &&
+            (entity[i].state != S_DEAD))
+            automap_draw_enemy(&(entity[i].pos));
+    }
+
+    automap_draw_player(&(player.pos), &(player.dir));
+}
+
 /**
  * @brief GAME render player gun sprite.
  *
@@ -1090,9 +1487,9 @@ void game_render_entities(float view_height)
 void game_render_gun(uint8_t pos, float jogging, bool fired, uint8_t reload)
 {
     // Jogging
-    int8_t x = 48 + sinf(millis() * JOGGING_SPEED) * 10 * jogging - 9;
-    int8_t y = fabsf(cosf(millis() * JOGGING_SPEED)) * 8 * jogging - 3 - pos +
-               RENDER_HEIGHT;
+    float phase = anim_time * (2 * PI / JOGGING_PERIOD_US);
+    int8_t x = 48 + sinf(phase) * 10 * jogging - 9;
+    int8_t y = fabsf(cosf(phase)) * 8 * jogging - 3 - pos + RENDER_HEIGHT;
 
     // Gun fire
     if ((pos > GUN_SHOT_POS - 2) && (player.ammo > 0) && (fired))
@@ -1213,23 +1610,13 @@ void game_jump_to_scene(GameScene scene)
         game_run_scene = game_run_music_scene;
         break;
 
-    case SCENE_STORY_INTRO:
-        game_cutscene = CUTSCENE_INTRO;
-        game_run_scene = game_run_story_scene;
-        break;
-
-    case SCENE_STORY_MID:
-        game_cutscene = CUTSCENE_MID;
-        game_run_scene = game_run_story_scene;
-        break;
-
-    case SCENE_STORY_END:
-        game_cutscene = CUTSCENE_END;
+    case SCENE_STORY:
         game_run_scene = game_run_story_scene;
         break;
 
     case SCENE_LEVEL:
-        game_init_level_scene(game_level);
+        game_load_level(game_level_id);
+        game_init_level_scene(&game_level);
         game_run_scene = game_run_level_scene;
         break;
 
@@ -1398,7 +1785,11 @@ void game_run_music_scene(void)
             game_music_enable = !game_music_enable;
         }
         else if (fire_pressed)
-            game_jump_to_scene(SCENE_STORY_INTRO);
+        {
+            game_level_id = 0;
+            game_cutscene = CUTSCENE_INTRO;
+            game_jump_to_scene(SCENE_STORY);
+        }
     }
 }
 
@@ -1408,6 +1799,11 @@ void game_run_music_scene(void)
  */
 void game_run_story_scene(void)
 {
+    // The next level is already set, to the first one by the music scene
+    // or to the following one by game_complete_level, so its data is
+    // prepared while the story is read
+    game_preload_level();
+
     if (game_cutscene == CUTSCENE_INTRO)
     {
         display_draw_text(0, 0, "YEAR 2027. HUMANS REACHED", 1);
@@ -1453,7 +1849,7 @@ void game_run_story_scene(void)
     {
         if (input_fire())
         {
-            if (game_cutscene != CUTSCENE_END)
+            if (game_level_id < game_episode.num_levels)
                 game_jump_to_scene(SCENE_LEVEL);
             else
                 game_jump_to_scene(SCENE_SCORE);
@@ -1474,52 +1870,12 @@ void game_run_level_scene(void)
     bool fire_pressed = input_fire();
     bool jump_pressed = input_jump();
 
-    // Check if player found trap room
-    if ((player.pos.x >= 2.0f) && (player.pos.x <= 3.0f) &&
-        (player.pos.y >= 54.0f) && (player.pos.y <= 55.0f) &&
-        (game_level == level_e1m1))
-    {
-        game_spawn_entity(E_ENEMY, 1, 51);
-        game_spawn_entity(E_ENEMY, 3, 51);
-    }
-
-    // Check if player found the exit in E1M2
-    if ((player.pos.x >= 46.0f) && (player.pos.x <= 47.0f) &&
-        (player.pos.y >= 35.0f) && (player.pos.y <= 36.0f) &&
-        (game_level == level_e1m2))
-    {
-        player.pos.x = 12.5f;
-        player.pos.y = 33.5f;
-        game_kill_count = 0;
-        game_kill_goal = ENEMY_KILL_GOAL2;
-        game_boss_fight = true;
-        game_spawn_entity(E_ENEMY, 10, 38);
-        game_spawn_entity(E_ENEMY, 13, 38);
-    }
-
-    // Boss fight
-    if ((game_level == level_e1m2) && (game_boss_fight))
-    {
-        if ((game_kill_count == 1) ||
-            (game_kill_count == 5) ||
-            (game_kill_count == 9))
-            game_spawn_entity(E_ENEMY, 13, 38);
-        else if ((game_kill_count == 3) ||
-                 (game_kill_count == 7) ||
-                 (game_kill_count == 11))
-            game_spawn_entity(E_ENEMY, 10, 38);
-        else if (game_kill_count == 13)
-            player.pos.y += 12;
-    }
+#ifdef LEVEL_HOT_RELOAD
+    game_reload_level();
+#endif
 
-    // Check if player got to the end of E1M2 level
-    if ((player.pos.y >= 55.0f) && (player.pos.y <= 56.0f) &&
-        (player.pos.x >= 12.0f) && (player.pos.x <= 23.0f) &&
-        (game_level == level_e1m2))
-    {
-        sound_play(mus_s1_snd, MUS_S1_SND_LEN, game_music_enable);
-        game_jump_to_scene(SCENE_STORY_END);
-    }
+    // Trap rooms, boss fight and level exit come from level triggers
+    game_update_triggers(&game_level);
 
     // If the player is alive
     if (player.health > 0)
@@ -1589,14 +1945,16 @@ void game_run_level_scene(void)
         }
         else
         {
-            player_view_height = fabsf(sinf(millis() * JOGGING_SPEED)) * 6 *
-                                 player_jogging;
+            player_view_height =
+                fabsf(sinf(anim_time * (2 * PI / JOGGING_PERIOD_US))) * 6 *
+                player_jogging;
             if (jump_pressed)
             {
                 player_jump_state = 1;
                 player_jogging = 0.0f;
                 gun_position = 22;
-                sound_play(jump_snd, JUMP_SND_LEN, game_music_enable);
+                sound_play(jump_snd, JUMP_SND_LEN, JUMP_SND_PRIORITY,
+                           game_music_enable);
             }
         }
 
@@ -1605,12 +1963,14 @@ void game_run_level_scene(void)
         {
             if (player_walk_sound)
             {
-                sound_play(walk1_snd, WALK1_SND_LEN, game_music_enable);
+                sound_play(walk1_snd, WALK1_SND_LEN, WALK1_SND_PRIORITY,
+                           game_music_enable);
                 player_walk_sound = false;
             }
             else
             {
-                sound_play(walk2_snd, WALK2_SND_LEN, game_music_enable);
+                sound_play(walk2_snd, WALK2_SND_LEN, WALK2_SND_PRIORITY,
+                           game_music_enable);
                 player_walk_sound = true;
             }
         }
@@ -1643,33 +2003,37 @@ void game_run_level_scene(void)
             gun_reload = true;
         }
 
-        if ((game_kill_count == game_kill_goal) && (game_level == level_e1m1))
+        // Levels with a kill goal are completed once it is reached
+        if ((game_level_info.kill_goal > 0) && !game_boss_fight &&
+            (game_kill_count >= game_kill_goal))
         {
             game_hud_text = TEXT_YOU_WIN;
             if (fire_pressed)
             {
-                player.pos.x = 230;
-                player.pos.y = 50;
-                game_kill_count = 0;
-                game_level = level_e1m2;
                 game_hud_text = TEXT_BLANK_SPACE;
-                game_jump_to_scene(SCENE_STORY_MID);
+                game_complete_level();
             }
         }
 
         game_update_position(
-            game_level,
+            &game_level,
             &(player.pos),
             player.dir.x * player.velocity * delta_time,
             player.dir.y * player.velocity * delta_time,
             false);
 
-        game_update_entities(game_level);
+        // Stream the chunk the player is heading to before rays reach it
+        float ahead = (player.velocity < 0.0f) ? -MAX_RENDER_DEPTH
+                                                : MAX_RENDER_DEPTH;
+        level_prefetch(&game_level,
+                       player.pos.x + player.dir.x * ahead,
+                       player.pos.y + player.dir.y * ahead);
+
+        game_update_entities(&game_level);
     }
     else
     {
         // The player is dead
-        game_level = level_e1m1;
         game_hud_text = TEXT_GAME_OVER;
 
         if (player_view_height > -5.0f)
@@ -1699,12 +2063,12 @@ void game_run_level_scene(void)
 
         case 3:
             gun_reload_animation = 2;
-            sound_play(r1_snd, R1_SND_LEN, game_music_enable);
+            sound_play(r1_snd, R1_SND_LEN, R1_SND_PRIORITY, game_music_enable);
             break;
 
         case 5:
             gun_reload_animation = 1;
-            sound_play(r2_snd, R2_SND_LEN, game_music_enable);
+            sound_play(r2_snd, R2_SND_LEN, R2_SND_PRIORITY, game_music_enable);
             break;
 
         case 7:
@@ -1718,11 +2082,23 @@ void game_run_level_scene(void)
         }
     }
 
-    // Render stuff
-    game_render_map(game_level, player_view_height);
-    game_render_entities(player_view_height);
-    game_render_gun(gun_position, player_jogging, gun_fired,
-                    gun_reload_animation);
+    // Automap is toggled when the button is pressed, not while held
+    if (input_map() && !screen_automap_pressed)
+        screen_automap = !screen_automap;
+    screen_automap_pressed = input_map();
+
+    // Render stuff, the raycaster keeps revealing automap tiles
+    game_render_map(&game_level, player_view_height);
+    if (screen_automap)
+    {
+        game_render_automap();
+    }
+    else
+    {
+        game_render_entities(&game_level, player_view_height);
+        game_render_gun(gun_position, player_jogging, gun_fired,
+                        gun_reload_animation);
+    }
 
     // Wait for transition animation
     if (!game_scene_transition())
@@ -1773,9 +2149,11 @@ void game_run_score_scene(void)
         return;
 
     if (game_score > SCORE_SECRET_ENDING)
-        sound_play(walk1_snd, WALK1_SND_LEN, game_music_enable);
+        sound_play(walk1_snd, WALK1_SND_LEN, WALK1_SND_PRIORITY,
+                   game_music_enable);
     else
-        sound_play(shot_snd, SHOT_SND_LEN, game_music_enable);
+        sound_play(shot_snd, SHOT_SND_LEN, SHOT_SND_PRIORITY,
+                   game_music_enable);
 
     if (input_fire())
         game_jump_to_scene(SCENE_INTRO);
@@ -1787,11 +2165,12 @@ void game_run_score_scene(void)
  */
 int main(void)
 {
-    /* Initialize game */
+    /* Initialize game, sound first as the platform may start audio */
+    sound_init();
     platform_init();
     display_init();
-    sound_init();
     input_init();
+    game_load_episode();
     game_run_scene = game_run_intro_scene;
 
     while (!input_exit())
@@ -1807,6 +2186,9 @@ int main(void)
 
         /* Stop drawing */
         display_draw_stop();
+
+        /* Print profiling counters */
+        profile_report();
     }
 
     return 0;
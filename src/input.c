@@ -111,4 +111,14 @@ bool input_exit(void)
     return input_button & EXIT;
 }
 
+/**
+ * @brief INPUT check if map button has been pressed.
+ * 
+ * @return bool button is pressed
+ */
+bool input_map(void)
+{
+    return input_button & MAP;
+}
+
 /* -------------------------------------------------------------------------- */
\ No newline at end of file
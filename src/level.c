@@ -0,0 +1,563 @@
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "level.h"
+#include "utils.h"
+
+/* Data types --------------------------------------------------------------- */
+
+typedef struct
+{
+    const uint8_t *source;
+    uint16_t chunk_x;
+    uint16_t chunk_y;
+    uint16_t last_used;
+    uint8_t map[LEVEL_CHUNK_BYTES];
+} LevelChunk;
+
+/* Function prototypes ------------------------------------------------------ */
+
+static LevelChunk *level_get_chunk(const Level *level, uint16_t chunk_x,
+                                   uint16_t chunk_y);
+static void level_read_chunk(const Level *level, uint16_t chunk_x,
+                             uint16_t chunk_y, uint8_t *map);
+static void level_decode_chunk(const uint8_t *data, const uint8_t *end,
+                               uint8_t *map);
+static uint16_t level_read_u16(const uint8_t *data);
+static uint32_t level_read_u32(const uint8_t *data);
+
+/* Global variables --------------------------------------------------------- */
+
+static LevelChunk level_chunk[LEVEL_CHUNK_CACHE_SIZE];
+static uint8_t level_chunk_last = 0;
+static uint16_t level_chunk_clock = 0;
+
+/* Function definitions ----------------------------------------------------- */
+
+/**
+ * @brief LEVEL load level from binary data, either mapped from a file or
+ * stored in flash.
+ *
+ * NOTE: Data is referenced and not copied, it must outlive the level.
+ *
+ * @param level Level to be loaded
+ * @param data  Level binary data
+ * @param size  Size of data in bytes
+ * @return bool Level data is valid
+ */
+bool level_load(Level *level, const uint8_t *data, uint32_t size)
+{
+    if ((data == NULL) || (size < LEVEL_HEADER_SIZE))
+        return false;
+
+    if ((memcmp(data, LEVEL_MAGIC, 4) != 0) || (data[4] != LEVEL_VERSION))
+        return false;
+
+    uint16_t width = level_read_u16(data + 6);
+    uint16_t height = level_read_u16(data + 8);
+    uint16_t num_spawns = level_read_u16(data + 10);
+    uint16_t num_triggers = level_read_u16(data + 12);
+    uint16_t player = level_read_u16(data + 14);
+    uint8_t flags = data[5];
+
+    if ((width == 0) || (width > LEVEL_MAX_WIDTH) ||
+        (height == 0) || (height > LEVEL_MAX_HEIGHT) ||
+        (num_spawns > MAX_SPAWN_POINTS) || (player >= num_spawns))
+        return false;
+
+    // Chunked maps are padded up to whole chunks
+    uint32_t map_size = (uint32_t)((width + 1) / 2) * height;
+    if (flags & LEVEL_FLAG_CHUNKED)
+    {
+        uint32_t chunks_x = (width + LEVEL_CHUNK_SIZE - 1) >> LEVEL_CHUNK_BASE;
+        uint32_t chunks_y = (height + LEVEL_CHUNK_SIZE - 1) >> LEVEL_CHUNK_BASE;
+        map_size = chunks_x * chunks_y * LEVEL_CHUNK_BYTES;
+
+        // Compressed size is the last entry of the chunk offsets table,
+        // chunks are decoded in place so offsets must increase up to it
+        if (flags & LEVEL_FLAG_RLE)
+        {
+            uint32_t table_size = (chunks_x * chunks_y + 1) * 4;
+            if (LEVEL_HEADER_SIZE + table_size > size)
+                return false;
+
+            uint32_t offset = 0;
+            for (uint32_t i = 0; i < table_size; i += 4)
+            {
+                uint32_t next = level_read_u32(data + LEVEL_HEADER_SIZE + i);
+                if (next < offset)
+                    return false;
+
+                offset = next;
+            }
+
+            if (offset > size - LEVEL_HEADER_SIZE - table_size)
+                return false;
+
+            map_size = table_size + offset;
+        }
+    }
+
+    // Sections follow the header without padding
+    uint32_t map_offset = LEVEL_HEADER_SIZE;
+    uint32_t spawns_offset = map_offset + map_size;
+    uint32_t triggers_offset = spawns_offset +
+                               (uint32_t)num_spawns * LEVEL_SPAWN_SIZE;
+    uint32_t solid_offset = triggers_offset +
+                            (uint32_t)num_triggers * LEVEL_TRIGGER_SIZE;
+    uint32_t index_offset = solid_offset +
+                            (uint32_t)((width + 7) / 8) * height;
+
+    // Trigger index size is the last chunk offset
+    uint32_t num_chunks =
+        (uint32_t)((width + LEVEL_CHUNK_SIZE - 1) >> LEVEL_CHUNK_BASE) *
+        ((height + LEVEL_CHUNK_SIZE - 1) >> LEVEL_CHUNK_BASE);
+    uint32_t refs_offset = index_offset + (num_chunks + 1) * 2;
+    if (refs_offset > size)
+        return false;
+
+    uint32_t pvs_offset = refs_offset +
+                          level_read_u16(data + refs_offset - 2) * 2;
+
+    uint32_t num_cells =
+        (uint32_t)((width + (1 << LEVEL_PVS_BASE) - 1) >> LEVEL_PVS_BASE) *
+        ((height + (1 << LEVEL_PVS_BASE) - 1) >> LEVEL_PVS_BASE);
+    uint32_t end_offset = pvs_offset + num_cells * LEVEL_PVS_BYTES;
+
+    if (end_offset > size)
+        return false;
+
+    // Chunk trigger lists must increase up to the refs size, and refs must
+    // be trigger numbers, so lookups stay within both sections
+    uint16_t num_refs = 0;
+    for (uint32_t i = 0; i <= num_chunks; i++)
+    {
+        uint16_t next = level_read_u16(data + index_offset + i * 2);
+        if (next < num_refs)
+            return false;
+
+        num_refs = next;
+    }
+
+    for (uint16_t i = 0; i < num_refs; i++)
+    {
+        if (level_read_u16(data + refs_offset + i * 2) >= num_triggers)
+            return false;
+    }
+
+    for (uint16_t i = 0; i < num_spawns; i++)
+    {
+        const uint8_t *spawn = data + spawns_offset + i * LEVEL_SPAWN_SIZE;
+        if ((level_read_u16(spawn + 2) >= width) ||
+            (level_read_u16(spawn + 4) >= height))
+            return false;
+    }
+
+    level->map = data + map_offset;
+    level->spawns = data + spawns_offset;
+    level->triggers = data + triggers_offset;
+    level->solid = data + solid_offset;
+    level->trigger_index = data + index_offset;
+    level->pvs = data + pvs_offset;
+    level->width = width;
+    level->height = height;
+    level->num_spawns = num_spawns;
+    level->num_triggers = num_triggers;
+    level->player = player;
+    level->flags = flags;
+
+    // Cached chunks may come from older data mapped at the same address
+    for (uint8_t i = 0; i < LEVEL_CHUNK_CACHE_SIZE; i++)
+    {
+        if (level_chunk[i].source == level->map)
+            level_chunk[i].source = NULL;
+    }
+
+    return true;
+}
+
+/**
+ * @brief LEVEL get entity type from level byte map.
+ *
+ * @param level Level
+ * @param x     X coordinate
+ * @param y     Y coordinate
+ * @return EntityType Entity type
+ */
+EntityType level_get_entity(const Level *level, int16_t x, int16_t y)
+{
+    if ((x < 0) || (x >= level->width) || (y < 0) || (y >= level->height))
+        return E_FLOOR;
+
+    LevelChunk *chunk = level_get_chunk(level, x >> LEVEL_CHUNK_BASE,
+                                        y >> LEVEL_CHUNK_BASE);
+    x &= LEVEL_CHUNK_SIZE - 1;
+    y &= LEVEL_CHUNK_SIZE - 1;
+
+    uint8_t byte = chunk->map[(y * LEVEL_CHUNK_SIZE + x) / 2];
+    byte >>= (x % 2) ? 0 : 4;
+
+    return byte & 0x0f;
+}
+
+/**
+ * @brief LEVEL check if a tile blocks rays from the precomputed bitset.
+ *
+ * @param level Level
+ * @param x     X coordinate
+ * @param y     Y coordinate
+ * @return bool Tile is solid
+ */
+bool level_is_solid(const Level *level, int16_t x, int16_t y)
+{
+    if ((x < 0) || (x >= level->width) || (y < 0) || (y >= level->height))
+        return false;
+
+    uint16_t stride = (level->width + 7) / 8;
+
+    return READ_BIT(level->solid[(uint32_t)y * stride + x / 8], x % 8);
+}
+
+/**
+ * @brief LEVEL check if a tile may be seen from another one, from the
+ * precomputed potentially visible set. Tiles beyond its range are reported
+ * as visible.
+ *
+ * @param level Level
+ * @param x0    Viewer X coordinate
+ * @param y0    Viewer Y coordinate
+ * @param x1    Target X coordinate
+ * @param y1    Target Y coordinate
+ * @return bool Target tile may be visible
+ */
+bool level_is_potentially_visible(const Level *level, int16_t x0, int16_t y0,
+                                  int16_t x1, int16_t y1)
+{
+    if ((x0 < 0) || (x0 >= level->width) || (y0 < 0) ||
+        (y0 >= level->height))
+        return true;
+
+    int16_t cell_x = x0 >> LEVEL_PVS_BASE;
+    int16_t cell_y = y0 >> LEVEL_PVS_BASE;
+    int16_t dx = (x1 >> LEVEL_PVS_BASE) - cell_x + LEVEL_PVS_RADIUS;
+    int16_t dy = (y1 >> LEVEL_PVS_BASE) - cell_y + LEVEL_PVS_RADIUS;
+
+    if ((x1 < 0) || (y1 < 0) || (dx < 0) || (dx >= LEVEL_PVS_SIZE) ||
+        (dy < 0) || (dy >= LEVEL_PVS_SIZE))
+        return true;
+
+    uint16_t cells_x = (level->width + (1 << LEVEL_PVS_BASE) - 1) >>
+                       LEVEL_PVS_BASE;
+    const uint8_t *pvs = level->pvs +
+                         ((uint32_t)cell_y * cells_x + cell_x) *
+                             LEVEL_PVS_BYTES;
+    uint8_t bit = dy * LEVEL_PVS_SIZE + dx;
+
+    return READ_BIT(pvs[bit / 8], bit % 8);
+}
+
+/**
+ * @brief LEVEL prefetch the map chunk holding a location into the cache.
+ *
+ * @param level Level
+ * @param x     X coordinate
+ * @param y     Y coordinate
+ */
+void level_prefetch(const Level *level, int16_t x, int16_t y)
+{
+    if ((x < 0) || (x >= level->width) || (y < 0) || (y >= level->height))
+        return;
+
+    level_get_chunk(level, x >> LEVEL_CHUNK_BASE, y >> LEVEL_CHUNK_BASE);
+}
+
+/**
+ * @brief LEVEL get spawn point from spawn list.
+ *
+ * @param level Level
+ * @param i     Spawn index
+ * @return LevelSpawn Spawn point
+ */
+LevelSpawn level_get_spawn(const Level *level, uint16_t i)
+{
+    const uint8_t *data = level->spawns + i * LEVEL_SPAWN_SIZE;
+
+    return (LevelSpawn){
+        .type = data[0],
+        .x = level_read_u16(data + 2),
+        .y = level_read_u16(data + 4)};
+}
+
+/**
+ * @brief LEVEL find spawn point index of a tile by binary search over the
+ * sorted spawn list.
+ *
+ * @param level Level
+ * @param x     X coordinate
+ * @param y     Y coordinate
+ * @return uint16_t Spawn index, SPAWN_NULL if none
+ */
+uint16_t level_find_spawn(const Level *level, int16_t x, int16_t y)
+{
+    if ((x < 0) || (x >= level->width) || (y < 0) || (y >= level->height))
+        return SPAWN_NULL;
+
+    // Spawns are sorted by row then column
+    uint32_t key = (uint32_t)y * level->width + x;
+    uint16_t low = 0;
+    uint16_t high = level->num_spawns;
+
+    while (low < high)
+    {
+        uint16_t mid = low + (high - low) / 2;
+        LevelSpawn spawn = level_get_spawn(level, mid);
+        uint32_t mid_key = (uint32_t)spawn.y * level->width + spawn.x;
+
+        if (mid_key == key)
+            return mid;
+        else if (mid_key < key)
+            low = mid + 1;
+        else
+            high = mid;
+    }
+
+    return SPAWN_NULL;
+}
+
+/**
+ * @brief LEVEL get trigger region from trigger list.
+ *
+ * @param level Level
+ * @param i     Trigger index
+ * @return LevelTrigger Trigger region
+ */
+LevelTrigger level_get_trigger(const Level *level, uint16_t i)
+{
+    const uint8_t *data = level->triggers + i * LEVEL_TRIGGER_SIZE;
+
+    return (LevelTrigger){
+        .x0 = level_read_u16(data),
+        .y0 = level_read_u16(data + 2),
+        .x1 = level_read_u16(data + 4),
+        .y1 = level_read_u16(data + 6),
+        .action = data[8],
+        .param = data[9],
+        .x = level_read_u16(data + 10),
+        .y = level_read_u16(data + 12),
+        .kills = data[14]};
+}
+
+/**
+ * @brief LEVEL find triggers whose region holds a tile, through the chunk
+ * trigger index.
+ *
+ * @param level Level
+ * @param x     X coordinate
+ * @param y     Y coordinate
+ * @param index Found trigger numbers
+ * @param max   Size of index
+ * @return uint8_t Number of triggers found
+ */
+uint8_t level_find_triggers(const Level *level, int16_t x, int16_t y,
+                            uint16_t *index, uint8_t max)
+{
+    if ((x < 0) || (x >= level->width) || (y < 0) || (y >= level->height))
+        return 0;
+
+    uint32_t chunks_x = (level->width + LEVEL_CHUNK_SIZE - 1) >>
+                        LEVEL_CHUNK_BASE;
+    uint32_t chunks_y = (level->height + LEVEL_CHUNK_SIZE - 1) >>
+                        LEVEL_CHUNK_BASE;
+    uint32_t chunk = (y >> LEVEL_CHUNK_BASE) * chunks_x +
+                     (x >> LEVEL_CHUNK_BASE);
+
+    const uint8_t *offsets = level->trigger_index + chunk * 2;
+    const uint8_t *refs = level->trigger_index + (chunks_x * chunks_y + 1) * 2;
+    uint16_t first = level_read_u16(offsets);
+    uint16_t last = level_read_u16(offsets + 2);
+    uint8_t count = 0;
+
+    for (uint16_t i = first; (i < last) && (count < max); i++)
+    {
+        // Trigger numbers are checked by level_load
+        uint16_t n = level_read_u16(refs + i * 2);
+        LevelTrigger trigger = level_get_trigger(level, n);
+        if ((x >= trigger.x0) && (x <= trigger.x1) &&
+            (y >= trigger.y0) && (y <= trigger.y1))
+            index[count++] = n;
+    }
+
+    return count;
+}
+
+/**
+ * @brief LEVEL get map chunk from the cache, reading it from level data and
+ * evicting the least recently used one on a miss.
+ *
+ * @param level   Level
+ * @param chunk_x Chunk X coordinate
+ * @param chunk_y Chunk Y coordinate
+ * @return LevelChunk* Cached chunk
+ */
+LevelChunk *level_get_chunk(const Level *level, uint16_t chunk_x,
+                            uint16_t chunk_y)
+{
+    // Most lookups hit the same chunk as the previous one
+    LevelChunk *chunk = &level_chunk[level_chunk_last];
+    if ((chunk->source == level->map) && (chunk->chunk_x == chunk_x) &&
+        (chunk->chunk_y == chunk_y))
+        return chunk;
+
+    uint8_t oldest = 0;
+    uint16_t oldest_age = 0;
+
+    for (uint8_t i = 0; i < LEVEL_CHUNK_CACHE_SIZE; i++)
+    {
+        chunk = &level_chunk[i];
+
+        if ((chunk->source == level->map) && (chunk->chunk_x == chunk_x) &&
+            (chunk->chunk_y == chunk_y))
+        {
+            chunk->last_used = ++level_chunk_clock;
+            level_chunk_last = i;
+            return chunk;
+        }
+
+        // Empty slots are taken first, wrap safe age otherwise
+        uint16_t age = (chunk->source == NULL)
+                           ? UINT16_MAX
+                           : (uint16_t)(level_chunk_clock - chunk->last_used);
+        if (age >= oldest_age)
+        {
+            oldest_age = age;
+            oldest = i;
+        }
+    }
+
+    chunk = &level_chunk[oldest];
+    level_read_chunk(level, chunk_x, chunk_y, chunk->map);
+    chunk->source = level->map;
+    chunk->chunk_x = chunk_x;
+    chunk->chunk_y = chunk_y;
+    chunk->last_used = ++level_chunk_clock;
+    level_chunk_last = oldest;
+
+    return chunk;
+}
+
+/**
+ * @brief LEVEL read map chunk from level data, tiles outside the level are
+ * read as floor.
+ *
+ * @param level   Level
+ * @param chunk_x Chunk X coordinate
+ * @param chunk_y Chunk Y coordinate
+ * @param map     Chunk map to be filled, LEVEL_CHUNK_BYTES long
+ */
+void level_read_chunk(const Level *level, uint16_t chunk_x, uint16_t chunk_y,
+                      uint8_t *map)
+{
+    if (level->flags & LEVEL_FLAG_CHUNKED)
+    {
+        uint32_t chunks_x = (level->width + LEVEL_CHUNK_SIZE - 1) >>
+                            LEVEL_CHUNK_BASE;
+        uint32_t index = (uint32_t)chunk_y * chunks_x + chunk_x;
+
+        if (level->flags & LEVEL_FLAG_RLE)
+        {
+            uint32_t chunks_y = (level->height + LEVEL_CHUNK_SIZE - 1) >>
+                                LEVEL_CHUNK_BASE;
+            const uint8_t *table = level->map + index * 4;
+            const uint8_t *data = level->map + (chunks_x * chunks_y + 1) * 4;
+
+            level_decode_chunk(data + level_read_u32(table),
+                               data + level_read_u32(table + 4), map);
+            return;
+        }
+
+        memcpy(map, level->map + index * LEVEL_CHUNK_BYTES, LEVEL_CHUNK_BYTES);
+        return;
+    }
+
+    // Gather chunk rows from the flat map, Y is stored in inverse order
+    uint16_t stride = (level->width + 1) / 2;
+    uint16_t offset = chunk_x * (LEVEL_CHUNK_SIZE / 2);
+    uint8_t length = MIN(LEVEL_CHUNK_SIZE / 2, stride - offset);
+
+    memset(map, 0, LEVEL_CHUNK_BYTES);
+
+    for (uint8_t i = 0; i < LEVEL_CHUNK_SIZE; i++)
+    {
+        uint16_t y = chunk_y * LEVEL_CHUNK_SIZE + i;
+        if (y >= level->height)
+            break;
+
+        const uint8_t *row = level->map +
+                             (uint32_t)(level->height - 1 - y) * stride;
+        memcpy(map + i * (LEVEL_CHUNK_SIZE / 2), row + offset, length);
+    }
+}
+
+/**
+ * @brief LEVEL decode run length encoded map chunk, output is bounded to
+ * LEVEL_CHUNK_BYTES and missing bytes are read as floor.
+ *
+ * @param data Compressed chunk
+ * @param end  End of compressed chunk
+ * @param map  Chunk map to be filled, LEVEL_CHUNK_BYTES long
+ */
+void level_decode_chunk(const uint8_t *data, const uint8_t *end, uint8_t *map)
+{
+    uint8_t i = 0;
+
+    while ((i < LEVEL_CHUNK_BYTES) && (data < end))
+    {
+        uint8_t control = *data++;
+        uint8_t count = MIN((control & 0x7f) + 1, LEVEL_CHUNK_BYTES - i);
+
+        if (control & 0x80)
+        {
+            if (data >= end)
+                break;
+
+            memset(map + i, *data++, count);
+        }
+        else
+        {
+            count = MIN(count, end - data);
+            memcpy(map + i, data, count);
+            data += count;
+        }
+
+        i += count;
+    }
+
+    memset(map + i, 0, LEVEL_CHUNK_BYTES - i);
+}
+
+/**
+ * @brief LEVEL read little endian 16 bit value, data may be unaligned.
+ *
+ * @param data Data pointer
+ * @return uint16_t Value
+ */
+uint16_t level_read_u16(const uint8_t *data)
+{
+    return data[0] | (data[1] << 8);
+}
+
+/**
+ * @brief LEVEL read little endian 32 bit value, data may be unaligned.
+ *
+ * @param data Data pointer
+ * @return uint32_t Value
+ */
+uint32_t level_read_u32(const uint8_t *data)
+{
+    return level_read_u16(data) | ((uint32_t)level_read_u16(data + 2) << 16);
+}
+
+/* -------------------------------------------------------------------------- */
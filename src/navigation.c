@@ -0,0 +1,282 @@
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+
+#include "navigation.h"
+#include "entities.h"
+#include "level.h"
+#include "profile.h"
+#include "utils.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+#define NAVIGATION_CELLS (NAVIGATION_SIZE * NAVIGATION_SIZE)
+#define NAVIGATION_BYTES ((NAVIGATION_CELLS + 7) / 8)
+
+/* Data types --------------------------------------------------------------- */
+
+typedef enum
+{
+    NAV_UNVISITED,
+    NAV_EAST,
+    NAV_WEST,
+    NAV_NORTH,
+    NAV_SOUTH,
+    NAV_TARGET,
+    NAV_BLOCKED
+} NavigationDir;
+
+/* Function prototypes ------------------------------------------------------ */
+
+static bool navigation_trace_ray(const Level *level, int16_t x, int16_t y);
+
+/* Global variables --------------------------------------------------------- */
+
+static const int8_t navigation_dir_x[] = {0, 1, -1, 0, 0};
+static const int8_t navigation_dir_y[] = {0, 0, 0, 1, -1};
+
+static uint8_t navigation_field[NAVIGATION_CELLS];
+static uint16_t navigation_queue[NAVIGATION_CELLS];
+static int16_t navigation_x;
+static int16_t navigation_y;
+static bool navigation_valid = false;
+
+/* Line of sight cache, one bit per flow field cell */
+static uint8_t navigation_los_known[NAVIGATION_BYTES];
+static uint8_t navigation_los_visible[NAVIGATION_BYTES];
+
+/* Function definitions ----------------------------------------------------- */
+
+/**
+ * @brief NAVIGATION invalidate flow field, e.g. when a new level is loaded.
+ *
+ */
+void navigation_init(void)
+{
+    navigation_valid = false;
+}
+
+/**
+ * @brief NAVIGATION update flow field towards target.
+ * @details Breadth-first search over the level grid seeded at the target tile
+ * and bounded to NAVIGATION_RADIUS. Nothing is done while the target stays
+ * in the same tile, otherwise the line of sight cache is also cleared.
+ *
+ * @param level  Level
+ * @param target Target position
+ */
+void navigation_update(const Level *level, Coords *target)
+{
+    int16_t target_x = target->x;
+    int16_t target_y = target->y;
+
+    if (navigation_valid && (target_x == navigation_x) &&
+        (target_y == navigation_y))
+        return;
+
+    navigation_x = target_x;
+    navigation_y = target_y;
+    navigation_valid = true;
+    memset(navigation_field, NAV_UNVISITED, NAVIGATION_CELLS);
+    memset(navigation_los_known, 0x00, NAVIGATION_BYTES);
+
+    // Seed the search at the center of the field
+    uint16_t head = 0;
+    uint16_t tail = 0;
+    uint16_t center = NAVIGATION_RADIUS * NAVIGATION_SIZE + NAVIGATION_RADIUS;
+    navigation_field[center] = NAV_TARGET;
+    navigation_queue[tail++] = center;
+
+    while (head < tail)
+    {
+        uint16_t cell = navigation_queue[head++];
+        int8_t cell_x = cell % NAVIGATION_SIZE;
+        int8_t cell_y = cell / NAVIGATION_SIZE;
+
+        for (uint8_t dir = NAV_EAST; dir <= NAV_SOUTH; dir++)
+        {
+            // Neighbour that reaches this cell moving along dir
+            int8_t x = cell_x - navigation_dir_x[dir];
+            int8_t y = cell_y - navigation_dir_y[dir];
+
+            if ((x < 0) || (x >= NAVIGATION_SIZE) || (y < 0) ||
+                (y >= NAVIGATION_SIZE))
+                continue;
+
+            uint16_t next = y * NAVIGATION_SIZE + x;
+            if (navigation_field[next] != NAV_UNVISITED)
+                continue;
+
+            // Same rule as game_detect_collision() with only_walls
+            EntityType block = level_get_entity(
+                level,
+                navigation_x + x - NAVIGATION_RADIUS,
+                navigation_y + y - NAVIGATION_RADIUS);
+
+            if (block == E_WALL)
+            {
+                navigation_field[next] = NAV_BLOCKED;
+                continue;
+            }
+
+            navigation_field[next] = dir;
+            navigation_queue[tail++] = next;
+        }
+    }
+}
+
+/**
+ * @brief NAVIGATION get movement direction towards flow field target.
+ *
+ * NOTE: Direction components are -1, 0 or 1, like SIGN().
+ *
+ * @param pos Current position
+ * @param dir Movement direction
+ * @return bool Direction is valid, false if target is unreachable, outside
+ * the flow field or in the same tile
+ */
+bool navigation_get_direction(Coords *pos, Coords *dir)
+{
+    if (!navigation_valid)
+        return false;
+
+    int16_t tile_x = pos->x;
+    int16_t tile_y = pos->y;
+    int16_t x = tile_x - navigation_x + NAVIGATION_RADIUS;
+    int16_t y = tile_y - navigation_y + NAVIGATION_RADIUS;
+
+    if ((x < 0) || (x >= NAVIGATION_SIZE) || (y < 0) ||
+        (y >= NAVIGATION_SIZE))
+        return false;
+
+    uint8_t flow = navigation_field[y * NAVIGATION_SIZE + x];
+    if ((flow < NAV_EAST) || (flow > NAV_SOUTH))
+        return false;
+
+    // Head to the center of the next tile, keeps away from wall corners
+    float offset_x = tile_x + navigation_dir_x[flow] + 0.5f - pos->x;
+    float offset_y = tile_y + navigation_dir_y[flow] + 0.5f - pos->y;
+
+    dir->x = (fabsf(offset_x) > NAVIGATION_DEADZONE) ? SIGN(offset_x, 0) : 0;
+    dir->y = (fabsf(offset_y) > NAVIGATION_DEADZONE) ? SIGN(offset_y, 0) : 0;
+
+    return true;
+}
+
+/**
+ * @brief NAVIGATION check line of sight between target and position tiles.
+ * @details Walks the grid with the same DDA used by the raycaster, from the
+ * target tile center to the position tile center. Results are cached per
+ * tile until the target moves to another tile.
+ *
+ * @param level Level
+ * @param pos   Position to be checked
+ * @return bool Position is visible from target, false if outside the flow
+ * field
+ */
+bool navigation_is_visible(const Level *level, Coords *pos)
+{
+    if (!navigation_valid)
+        return false;
+
+    int16_t tile_x = pos->x;
+    int16_t tile_y = pos->y;
+    int16_t x = tile_x - navigation_x + NAVIGATION_RADIUS;
+    int16_t y = tile_y - navigation_y + NAVIGATION_RADIUS;
+
+    if ((x < 0) || (x >= NAVIGATION_SIZE) || (y < 0) ||
+        (y >= NAVIGATION_SIZE))
+        return false;
+
+    uint16_t cell = y * NAVIGATION_SIZE + x;
+    uint8_t mask = 1 << (cell % 8);
+
+    if (!(navigation_los_known[cell / 8] & mask))
+    {
+        navigation_los_known[cell / 8] |= mask;
+        if (navigation_trace_ray(level, tile_x, tile_y))
+            navigation_los_visible[cell / 8] |= mask;
+        else
+            navigation_los_visible[cell / 8] &= ~mask;
+    }
+
+    return navigation_los_visible[cell / 8] & mask;
+}
+
+/**
+ * @brief NAVIGATION update visibility flag of all enemies in one pass.
+ *
+ * @param level  Level
+ * @param entity Entities array
+ * @param num    Number of entities
+ */
+void navigation_update_visibility(const Level *level, Entity entity[],
+                                  uint8_t num)
+{
+    for (uint8_t i = 0; i < num; i++)
+    {
+        if (entities_get_type(entity[i].uid) != E_ENEMY)
+            continue;
+
+        // No ray is traced for enemies out of the target PVS
+        if (!level_is_potentially_visible(level, navigation_x, navigation_y,
+                                          entity[i].pos.x, entity[i].pos.y))
+        {
+            entity[i].visible = false;
+            profile_add(PROFILE_LOS_CULLED, 1);
+            continue;
+        }
+
+        entity[i].visible = navigation_is_visible(level, &(entity[i].pos));
+    }
+}
+
+/**
+ * @brief NAVIGATION trace a ray from target tile center to a given tile.
+ * NOTE: Same DDA as game_render_map(), see
+ * https://lodev.org/cgtutor/raycasting.html
+ *
+ * @param level Level
+ * @param x     X tile coordinate
+ * @param y     Y tile coordinate
+ * @return bool No wall has been hit before reaching the tile
+ */
+bool navigation_trace_ray(const Level *level, int16_t x, int16_t y)
+{
+    float ray_x = x - navigation_x;
+    float ray_y = y - navigation_y;
+    int16_t map_x = navigation_x;
+    int16_t map_y = navigation_y;
+    float delta_x = fabsf(1.0f / ray_x);
+    float delta_y = fabsf(1.0f / ray_y);
+
+    // Rays start from the tile center
+    int8_t step_x = (ray_x < 0.0f) ? -1 : 1;
+    int8_t step_y = (ray_y < 0.0f) ? -1 : 1;
+    float side_x = 0.5f * delta_x;
+    float side_y = 0.5f * delta_y;
+
+    while ((map_x != x) || (map_y != y))
+    {
+        if (side_x < side_y)
+        {
+            side_x += delta_x;
+            map_x += step_x;
+        }
+        else
+        {
+            side_y += delta_y;
+            map_y += step_y;
+        }
+
+        if (level_is_solid(level, map_x, map_y))
+            return false;
+    }
+
+    return true;
+}
+
+/* -------------------------------------------------------------------------- */
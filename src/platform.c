@@ -5,10 +5,25 @@
 #include <time.h>
 #include <limits.h>
 
+#if defined(USE_RAYLIB) && defined(__unix__)
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#if defined(USE_RAYLIB) && defined(__linux__) && defined(LEVEL_HOT_RELOAD)
+#include <string.h>
+#include <sys/inotify.h>
+#endif
+
 #include "platform.h"
 #include "constants.h"
 #include "sound.h"
 #include "input.h"
+#include "profile.h"
+#include "utils.h"
 
 #ifdef USE_RAYLIB
 #include "raylib.h"
@@ -19,21 +34,26 @@
 #define WINDOW_WIDTH (SCREEN_WIDTH * WINDOW_ZOOM)
 #define WINDOW_HEIGHT (SCREEN_HEIGHT * WINDOW_ZOOM)
 
-#define AUDIO_SAMPLING_RATE 44100.0f
+#define AUDIO_SAMPLING_RATE 44100
 #define AUDIO_BUFFER_MAX_SAMPLES 512
 #define AUDIO_BUFFER_DEFAULT_SIZE 4096
 #define AUDIO_SAMPLE_SIZE 16
 #define AUDIO_CHANNEL_NUM 1
 
+/* Frame sleeps end this early, then spin up to the deadline, as the scheduler
+ * may wake the game up late */
+#define FRAME_SPIN_NS 1000000
+
 /* Global variables --------------------------------------------------------- */
 
-static uint32_t clock_t0;
-static bool audio_is_playing;
+static int64_t clock_t0;
+static int64_t frame_deadline;
 static AudioStream audio_stream;
 
 /* Function prototypes ------------------------------------------------------ */
 
 void platform_audio_callback(void *buffer, unsigned int frames);
+static int64_t platform_time_ns(void);
 
 /* Function definitions ----------------------------------------------------- */
 
@@ -45,7 +65,6 @@ void platform_init(void)
 {
     /* Window initialization */
     InitWindow(WINDOW_WIDTH, WINDOW_HEIGHT, "Doom Pico");
-    SetTargetFPS(FPS);
 
     /* Audio initialization */
     InitAudioDevice();
@@ -56,10 +75,8 @@ void platform_init(void)
         AUDIO_CHANNEL_NUM);
     SetAudioStreamCallback(audio_stream, platform_audio_callback);
     PlayAudioStream(audio_stream);
-    PauseAudioStream(audio_stream);
 
-    audio_is_playing = false;
-    clock_t0 = clock();
+    clock_t0 = platform_time_ns();
 }
 
 /**
@@ -109,11 +126,8 @@ void platform_draw_pixel(uint8_t x, uint8_t y, bool color)
  */
 void platform_audio_play(void)
 {
-    if (!audio_is_playing)
-    {
-        audio_is_playing = true;
-        ResumeAudioStream(audio_stream);
-    }
+    // Stream always runs, rendering silence between sounds, so the audio
+    // callback is the only reader of the sound state
 }
 
 /**
@@ -128,33 +142,8 @@ void platform_audio_play(void)
  */
 void platform_audio_callback(void *buffer, unsigned int frames)
 {
-    // Get next frequency to play
-    uint16_t frequency = sound_get_frequency();
-
-    // End of sound, pause stream
-    if (frequency == 0)
-    {
-        if (audio_is_playing)
-        {
-            audio_is_playing = false;
-            PauseAudioStream(audio_stream);
-        }
-        return;
-    }
-    else
-    {
-        if (!audio_is_playing)
-        {
-            audio_is_playing = true;
-            ResumeAudioStream(audio_stream);
-        }
-    }
-
-    // Create square wave with given frequency
-    uint16_t wave_length = AUDIO_SAMPLING_RATE / frequency;
-    uint16_t *buf = (uint16_t *)buffer;
-    for (uint16_t i = 0; i < frames; i++)
-        buf[i] = (i % wave_length) < (wave_length / 2) ? SHRT_MAX : SHRT_MIN;
+    // Sound steps are clocked by samples, not by buffers or CPU time
+    sound_render((int16_t *)buffer, frames, AUDIO_SAMPLING_RATE);
 }
 
 /**
@@ -181,6 +170,8 @@ void platform_input_update(void)
         input_button |= HOME;
     if (IsKeyDown(KEY_ESCAPE))
         input_button |= EXIT;
+    if (IsKeyDown(KEY_TAB))
+        input_button |= MAP;
 }
 
 /**
@@ -190,7 +181,29 @@ void platform_input_update(void)
  */
 uint32_t platform_millis(void)
 {
-    return ((clock() - clock_t0) * 1000) / CLOCKS_PER_SEC;
+    return platform_nanos() / 1000000;
+}
+
+/**
+ * @brief PLATFORM get monotonic time in microseconds from start of execution,
+ * wrapping around every 71 minutes, so only compare times through unsigned
+ * 32-bit differences.
+ * 
+ * @return uint32_t Start time in microseconds
+ */
+uint32_t platform_micros(void)
+{
+    return (uint32_t)(platform_nanos() / 1000);
+}
+
+/**
+ * @brief PLATFORM get monotonic time in nanoseconds from start of execution.
+ * 
+ * @return uint64_t Start time in nanoseconds
+ */
+uint64_t platform_nanos(void)
+{
+    return platform_time_ns() - clock_t0;
 }
 
 /**
@@ -200,15 +213,197 @@ uint32_t platform_millis(void)
  */
 void platform_delay(uint32_t ms)
 {
-    uint32_t t0 = platform_millis();
-    while ((platform_millis() - t0) < ms)
+#ifdef __unix__
+    struct timespec time = {ms / 1000, (ms % 1000) * 1000000L};
+    while (clock_nanosleep(CLOCK_MONOTONIC, 0, &time, &time) == EINTR)
+    {
+    };
+#else
+    WaitTime(ms / 1000.0);
+#endif
+}
+
+/**
+ * @brief PLATFORM sleep until the next frame deadline, deadlines being
+ * period_us apart, without busy waiting where possible.
+ * 
+ * @param period_us Frame period in microseconds
+ */
+void platform_wait_frame(uint32_t period_us)
+{
+    int64_t period = (int64_t)period_us * 1000;
+    int64_t start = platform_time_ns();
+
+    // Deadlines follow a fixed schedule, so late frames are caught up, unless
+    // more than a frame late (first frame, level loading), then it restarts
+    frame_deadline += period;
+    if (start - frame_deadline > period)
+        frame_deadline = start;
+
+    int64_t wake = frame_deadline - FRAME_SPIN_NS;
+    if (start < wake)
+    {
+#ifdef __unix__
+        struct timespec time = {wake / 1000000000, wake % 1000000000};
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &time, NULL) ==
+               EINTR)
+        {
+        };
+#else
+        WaitTime((wake - start) / 1e9);
+#endif
+    }
+
+    int64_t idle = platform_time_ns() - start;
+    int64_t now;
+    while ((now = platform_time_ns()) < frame_deadline)
     {
-        asm("nop");
     };
+
+    profile_add(PROFILE_FRAME_IDLE, MIN(idle * 100 / period, 100));
+    profile_add(PROFILE_FRAME_JITTER,
+                MIN((now - frame_deadline) / 1000, UINT16_MAX));
+}
+
+/**
+ * @brief PLATFORM get monotonic time in nanoseconds, not affected by sleeps
+ * or system clock changes.
+ * 
+ * @return int64_t Time in nanoseconds from an arbitrary origin
+ */
+int64_t platform_time_ns(void)
+{
+#ifdef __unix__
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return (int64_t)time.tv_sec * 1000000000 + time.tv_nsec;
+#else
+    return GetTime() * 1e9;
+#endif
+}
+
+/**
+ * @brief PLATFORM map a read-only file into memory.
+ * 
+ * @param path File path
+ * @param size Size of the mapped file in bytes
+ * @return const uint8_t* Mapped file data, NULL if not available
+ */
+const uint8_t *platform_map_file(const char *path, uint32_t *size)
+{
+#ifdef __unix__
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+        return NULL;
+
+    struct stat st;
+    if ((fstat(fd, &st) < 0) || (st.st_size == 0))
+    {
+        close(fd);
+        return NULL;
+    }
+
+    // Mapping stays valid after closing the file descriptor
+    void *data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+        return NULL;
+
+    *size = st.st_size;
+    return data;
+#else
+    (void)path;
+    (void)size;
+    return NULL;
+#endif
+}
+
+/**
+ * @brief PLATFORM unmap a file mapped with platform_map_file.
+ * 
+ * @param data Mapped file data
+ * @param size Size of the mapped file in bytes
+ */
+void platform_unmap_file(const uint8_t *data, uint32_t size)
+{
+#ifdef __unix__
+    munmap((void *)data, size);
+#else
+    (void)data;
+    (void)size;
+#endif
 }
 
+#ifdef LEVEL_HOT_RELOAD
+/**
+ * @brief PLATFORM check if a file was written or replaced since the last call.
+ * The directory of the file is watched with inotify, so files replaced by
+ * rename are detected too. Only the directory of the first path is watched.
+ * 
+ * @param path File path
+ * @return true File changed
+ * @return false File unchanged or not watched
+ */
+bool platform_file_changed(const char *path)
+{
+#ifdef __linux__
+    static int fd = -1;
+
+    const char *name = strrchr(path, '/');
+    name = (name != NULL) ? name + 1 : path;
+
+    if (fd < 0)
+    {
+        char dir[PATH_MAX];
+        int length = (name > path) ? (int)(name - path - 1) : 1;
+        snprintf(dir, sizeof(dir), "%.*s", length, (name > path) ? path : ".");
+
+        fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (fd < 0)
+            return false;
+
+        // Retried on the next call if the directory does not exist yet
+        if (inotify_add_watch(fd, dir, IN_CLOSE_WRITE | IN_MOVED_TO) < 0)
+        {
+            close(fd);
+            fd = -1;
+            return false;
+        }
+    }
+
+    // Drain all pending events, events of other files are dropped
+    char buffer[4096]
+        __attribute__((aligned(__alignof__(struct inotify_event))));
+    bool changed = false;
+    ssize_t length;
+
+    while ((length = read(fd, buffer, sizeof(buffer))) > 0)
+    {
+        const struct inotify_event *event;
+        for (char *ptr = buffer; ptr < buffer + length;
+             ptr += sizeof(struct inotify_event) + event->len)
+        {
+            event = (const struct inotify_event *)ptr;
+            if ((event->len > 0) && (strcmp(event->name, name) == 0))
+                changed = true;
+        }
+    }
+
+    return changed;
+#else
+    (void)path;
+    return false;
+#endif
+}
+#endif
+
 #else /* User-defined platform functions ------------------------------------ */
 
+/* Virtual clock of the time functions below until they read a hardware timer,
+ * moved by platform_delay and platform_wait_frame, so the game runs unpaced at
+ * its nominal speed instead of freezing every animation on a zero clock */
+static uint64_t platform_clock_ns = 0;
+
 /**
  * @brief PLATFORM initialize user-defined functions.
  * 
@@ -272,8 +467,33 @@ void platform_input_update(void)
  * @return uint32_t Start time in milliseconds
  */
 uint32_t platform_millis(void)
+{
+    /* Add definition here, e.g. count 1 ms SysTick interrupts */
+    return platform_nanos() / 1000000;
+}
+
+/**
+ * @brief PLATFORM get monotonic time in microseconds from start of execution,
+ * wrapping around every 71 minutes, so only compare times through unsigned
+ * 32-bit differences.
+ * 
+ * @return uint32_t Start time in microseconds
+ */
+uint32_t platform_micros(void)
+{
+    /* Add definition here, e.g. read a free running 32-bit timer at 1 MHz */
+    return (uint32_t)(platform_nanos() / 1000);
+}
+
+/**
+ * @brief PLATFORM get monotonic time in nanoseconds from start of execution.
+ * 
+ * @return uint64_t Start time in nanoseconds
+ */
+uint64_t platform_nanos(void)
 {
     /* Add definition here */
+    return platform_clock_ns;
 }
 
 /**
@@ -284,8 +504,67 @@ uint32_t platform_millis(void)
 void platform_delay(uint32_t ms)
 {
     /* Add definition here */
+    platform_clock_ns += (uint64_t)ms * 1000000;
 }
 
+/**
+ * @brief PLATFORM sleep until the next frame deadline, deadlines being
+ * period_us apart, without busy waiting where possible.
+ * 
+ * @param period_us Frame period in microseconds
+ */
+void platform_wait_frame(uint32_t period_us)
+{
+    /* Add definition here, e.g. set a timer compare at the deadline and WFI
+     * until its interrupt. Until then frames are not paced, and the virtual
+     * clock moves to the deadline */
+    platform_clock_ns += (uint64_t)period_us * 1000;
+}
+
+/**
+ * @brief PLATFORM map a read-only file into memory.
+ * 
+ * @param path File path
+ * @param size Size of the mapped file in bytes
+ * @return const uint8_t* Mapped file data, NULL if not available
+ */
+const uint8_t *platform_map_file(const char *path, uint32_t *size)
+{
+    /* Add definition here, return NULL to use the levels stored in flash */
+    (void)path;
+    (void)size;
+    return NULL;
+}
+
+/**
+ * @brief PLATFORM unmap a file mapped with platform_map_file.
+ * 
+ * @param data Mapped file data
+ * @param size Size of the mapped file in bytes
+ */
+void platform_unmap_file(const uint8_t *data, uint32_t size)
+{
+    /* Add definition here */
+    (void)data;
+    (void)size;
+}
+
+#ifdef LEVEL_HOT_RELOAD
+/**
+ * @brief PLATFORM check if a file was written or replaced since the last call.
+ * 
+ * @param path File path
+ * @return true File changed
+ * @return false File unchanged or not watched
+ */
+bool platform_file_changed(const char *path)
+{
+    /* Add definition here, only needed for level hot reload builds */
+    (void)path;
+    return false;
+}
+#endif
+
 #endif /* USE_RAYLIB */
 
 /* -------------------------------------------------------------------------- */
\ No newline at end of file
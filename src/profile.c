@@ -0,0 +1,41 @@
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "profile.h"
+
+/* Global variables --------------------------------------------------------- */
+
+uint16_t profile_counter[PROFILE_COUNTERS];
+
+#if PROFILE_ENABLE
+static const char *profile_name[PROFILE_COUNTERS] = {
+    "entities_updated",
+    "entities_skipped",
+    "entities_culled",
+    "los_culled",
+    "frame_idle_pct",
+    "frame_jitter_us"};
+#endif
+
+/* Function definitions ----------------------------------------------------- */
+
+/**
+ * @brief PROFILE print per-frame counters and reset them.
+ *
+ * NOTE: Does nothing unless PROFILE_ENABLE is set.
+ *
+ */
+void profile_report(void)
+{
+#if PROFILE_ENABLE
+    for (uint8_t i = 0; i < PROFILE_COUNTERS; i++)
+        printf("%s=%u ", profile_name[i], profile_counter[i]);
+    printf("\n");
+
+    memset(profile_counter, 0x00, sizeof(profile_counter));
+#endif
+}
+
+/* -------------------------------------------------------------------------- */
@@ -2,16 +2,142 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "sound.h"
 #include "platform.h"
+#include "utils.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+/* Queue indices are shared between the game and the audio callback, which may
+ * be another thread or an ISR. With C11 atomics, acquire / release ordering
+ * publishes a command before its index. Otherwise, on a single core MCU, byte
+ * accesses are atomic and a compiler barrier is enough. */
+#ifndef __STDC_NO_ATOMICS__
+#include <stdatomic.h>
+#define SOUND_INDEX                   _Atomic uint8_t
+#define SOUND_INDEX_LOAD(index)       \
+    atomic_load_explicit(&(index), memory_order_acquire)
+#define SOUND_INDEX_STORE(index, val) \
+    atomic_store_explicit(&(index), (val), memory_order_release)
+#else
+#define SOUND_INDEX                   volatile uint8_t
+#define SOUND_INDEX_LOAD(index)       (index)
+#define SOUND_INDEX_STORE(index, val) \
+    do                                \
+    {                                 \
+        asm volatile("" ::: "memory"); \
+        (index) = (val);              \
+    } while (0)
+#endif
+
+/* Test hook of the host stress test, see sound_queue_trace */
+#ifdef SOUND_QUEUE_TRACE
+#define SOUND_TRACE(command, queued)                                          \
+    sound_queue_trace((command)->snd, (command)->len, (command)->priority,    \
+                      (command)->pattern, (command)->loop, (queued))
+#else
+#define SOUND_TRACE(command, queued)
+#endif
+
+/* Power of two, so free running indices wrap with the buffer */
+#define SOUND_QUEUE_SIZE 16
+
+/* At most 4 commands are read per pattern step, a repeat, the end and a
+ * repeat after looping back */
+#define SOUND_PATTERN_MAX_COMMANDS 4
+
+#ifdef SOUND_PCM_CACHE
+/* Every sound of sound.h, and their total number of steps */
+#define SOUND_CACHE_COUNT(name, NAME) +1
+#define SOUND_CACHE_STEP(name, NAME)  +NAME##_SND_LEN
+#define SOUND_CACHE_ENTRY(name, NAME) {name##_snd, NAME##_SND_LEN, 0, 0},
+
+#define SOUND_CACHE_SOUNDS (0 SOUND_LIST(SOUND_CACHE_COUNT))
+#define SOUND_CACHE_STEPS  (0 SOUND_LIST(SOUND_CACHE_STEP))
+
+/* Rounding up each sound takes at most one more sample per sound */
+#define SOUND_CACHE_FRAMES                                                    \
+    (SOUND_CACHE_STEPS * SOUND_CACHE_RATE / SOUND_STEP_RATE +                 \
+     SOUND_CACHE_SOUNDS)
+#endif
+
+/* Data types --------------------------------------------------------------- */
+
+typedef struct
+{
+    const uint8_t *snd;
+    uint8_t len;
+    uint8_t priority;
+    bool pattern;
+    bool loop;
+} SoundCommand;
+
+typedef struct
+{
+    const uint8_t *snd;
+    uint8_t len;
+    uint8_t idx;
+    uint8_t priority;
+    uint8_t step;
+    uint32_t clock;
+    uint32_t phase;
+    bool pattern;
+    bool loop;
+    uint8_t value;
+    uint8_t ticks;
+    uint8_t repeats;
+    uint16_t pos;
+#ifdef SOUND_PCM_CACHE
+    const int16_t *pcm;
+    uint32_t frames;
+#endif
+} SoundVoice;
+
+#ifdef SOUND_PCM_CACHE
+typedef struct
+{
+    const uint8_t *snd;
+    uint8_t len;
+    uint32_t offset;
+    uint32_t frames;
+} SoundCacheEntry;
+#endif
+
+/* Function prototypes ------------------------------------------------------ */
+
+static void sound_push(const SoundCommand *command);
+static void sound_read_queue(void);
+static void sound_start(const SoundCommand *command);
+static void sound_voice_next(SoundVoice *voice);
+static void sound_pattern_next(SoundVoice *voice);
+static uint16_t sound_voice_frequency(const SoundVoice *voice);
+static uint32_t sound_synth_voice(SoundVoice *voice, int16_t *buffer,
+                                  uint32_t frames, uint32_t rate);
+#ifdef SOUND_PCM_CACHE
+static void sound_cache_init(void);
+static uint32_t sound_cache_voice(SoundVoice *voice, int16_t *buffer,
+                                  uint32_t frames);
+#endif
 
 /* Global variables --------------------------------------------------------- */
 
-static uint8_t *sound_ptr;
-static uint8_t sound_len;
-static uint8_t sound_idx;
-static uint32_t sound_t0;
+/* Commands from the game, single producer and single consumer ring */
+static SoundCommand sound_queue[SOUND_QUEUE_SIZE];
+static SOUND_INDEX sound_queue_head;
+static SOUND_INDEX sound_queue_tail;
+
+/* Player state, only accessed from the audio callback */
+static SoundVoice sound_voices[SOUND_VOICES];
+
+#ifdef SOUND_PCM_CACHE
+static SoundCacheEntry sound_cache[SOUND_CACHE_SOUNDS] = {
+    SOUND_LIST(SOUND_CACHE_ENTRY)};
+
+/* Samples of every sound at SOUND_CACHE_RATE, one voice amplitude */
+static int16_t sound_cache_pcm[SOUND_CACHE_FRAMES];
+#endif
 
 /* Function definitions ----------------------------------------------------- */
 
@@ -21,65 +147,472 @@ static uint32_t sound_t0;
  */
 void sound_init(void)
 {
-    sound_ptr = NULL;
-    sound_len = 0;
+    memset(sound_voices, 0x00, sizeof(sound_voices));
+#ifdef SOUND_PCM_CACHE
+    sound_cache_init();
+#endif
+    sound_queue_head = 0;
+    sound_queue_tail = 0;
 }
 
 /**
  * @brief SOUND update sound and execute platform audio player.
+ * @details The sound is queued for the audio callback, which starts it on its
+ * next sound_render call in a free voice. When all voices are busy, it
+ * restarts the voice already playing the same sound, or steals the lowest
+ * priority voice closest to its end, or is dropped if every voice has a
+ * higher priority.
  *
- * @param snd    Sound byte array
- * @param len    Byte length of sound
- * @param enable Enable speakers
+ * @param snd      Sound byte array
+ * @param len      Byte length of sound
+ * @param priority Sound priority, higher values steal lower ones
+ * @param enable   Enable speakers
  */
-void sound_play(const uint8_t *snd, uint8_t len, bool enable)
+void sound_play(const uint8_t *snd, uint8_t len, uint8_t priority,
+                bool enable)
 {
     if (!enable)
         return;
 
-    // Assign new sound effect
-    sound_ptr = (uint8_t *)snd;
-    sound_len = len;
+    sound_push(&(SoundCommand){snd, len, priority, false, false});
+}
 
-    // Init sound player state
-    sound_idx = 0;
-    sound_t0 = platform_millis();
+/**
+ * @brief SOUND play a pattern like sound_play, see SOUND_PATTERN_END.
+ * @details Pattern voices always count as the longest sounds when stealing.
+ *
+ * @param pattern  Pattern byte array
+ * @param priority Sound priority, higher values steal lower ones
+ * @param loop     Restart the pattern at its end
+ * @param enable   Enable speakers
+ */
+void sound_play_pattern(const uint8_t *pattern, uint8_t priority, bool loop,
+                        bool enable)
+{
+    if (!enable)
+        return;
 
-    // Execute platform audio player
-    platform_audio_play();
+    sound_push(&(SoundCommand){pattern, UINT8_MAX, priority, true, loop});
 }
 
 /**
- * @brief SOUND get a new frequency from current sound every (1/140)s period,
- * otherwise return the same one again. Return zero if sound is finished.
+ * @brief SOUND get frequency of the current step of the highest priority
+ * voice, for single tone speakers. Return zero if sound is finished or paused.
  *
  * NOTE: Sounds use inverse frequency format, for more information see:
  * 1. http://fabiensanglard.net/gebbwolf3d_v2.1.pdf chapter 4.9.5
  * 2. http://www.shikadi.net/moddingwiki/Inverse_Frequency_Sound_format
  * 3. http://www.shikadi.net/moddingwiki/AudioT_Format
  *
- * @return uint16_t Next sound frequency
+ * @return uint16_t Current sound frequency
  */
 uint16_t sound_get_frequency(void)
 {
-    // Return zero if sound is finished
-    if (sound_idx >= sound_len)
-        return 0;
+    const SoundVoice *top = NULL;
+
+    for (uint8_t i = 0; i < SOUND_VOICES; i++)
+    {
+        const SoundVoice *voice = &sound_voices[i];
+
+        if ((voice->idx < voice->len) &&
+            ((top == NULL) || (voice->priority > top->priority)))
+            top = voice;
+    }
+
+    return (top != NULL) ? sound_voice_frequency(top) : 0;
+}
+
+/**
+ * @brief SOUND render the mix of all voices into PCM buffer, silence once
+ * finished.
+ * @details Sound steps are clocked by the number of rendered samples, a step
+ * ends at sample ceil((step + 1) * rate / SOUND_STEP_RATE), so frequency
+ * changes at exact sample offsets whatever the buffer size is. The cost is
+ * at most one addition per voice and sample.
+ *
+ * @param buffer Signed 16-bit mono samples
+ * @param frames Number of samples
+ * @param rate   Sampling rate in Hz
+ * @return bool A sound is still playing
+ */
+bool sound_render(int16_t *buffer, size_t frames, uint32_t rate)
+{
+    bool playing = false;
+
+    sound_read_queue();
+    memset(buffer, 0x00, frames * sizeof(int16_t));
+
+    for (uint8_t v = 0; v < SOUND_VOICES; v++)
+    {
+        SoundVoice *voice = &sound_voices[v];
+
+#ifdef SOUND_PCM_CACHE
+        if ((voice->pcm != NULL) && (rate == SOUND_CACHE_RATE))
+            sound_cache_voice(voice, buffer, frames);
+        else
+#endif
+            sound_synth_voice(voice, buffer, frames, rate);
+
+        playing |= (voice->idx < voice->len);
+    }
+
+    return playing;
+}
+
+/**
+ * @brief SOUND render the mix of all voices into a PWM DMA buffer, as duty
+ * values from 0 to period, period / 2 being silence.
+ * @details Same as sound_render, with the samples converted in place, so a
+ * port fills a whole DMA buffer with a single call from its half or full
+ * transfer interrupt.
+ *
+ * @param duty   PWM duty values
+ * @param frames Number of samples
+ * @param rate   Sampling rate in Hz
+ * @param period PWM timer period
+ * @return bool A sound is still playing
+ */
+bool sound_render_pwm(uint16_t *duty, size_t frames, uint32_t rate,
+                      uint16_t period)
+{
+    // Signed and unsigned samples have the same size and may alias
+    int16_t *buffer = (int16_t *)duty;
+    bool playing = sound_render(buffer, frames, rate);
+
+    // Offset binary scaled to the period, one multiply per sample
+    for (size_t i = 0; i < frames; i++)
+        duty[i] = ((uint32_t)(buffer[i] + 32768) * period) >> 16;
+
+    return playing;
+}
+
+/**
+ * @brief SOUND queue a command for the audio callback and execute platform
+ * audio player.
+ *
+ * @param command Sound to start
+ */
+void sound_push(const SoundCommand *command)
+{
+    // Only the audio callback moves the tail
+    uint8_t head = sound_queue_head;
+    uint8_t tail = SOUND_INDEX_LOAD(sound_queue_tail);
+
+    // Queue full, the audio callback is not running
+    if ((uint8_t)(head - tail) >= SOUND_QUEUE_SIZE)
+    {
+        SOUND_TRACE(command, false);
+        return;
+    }
+
+    sound_queue[head & (SOUND_QUEUE_SIZE - 1)] = *command;
+    SOUND_INDEX_STORE(sound_queue_head, head + 1);
+
+    // Execute platform audio player
+    platform_audio_play();
+}
+
+/**
+ * @brief SOUND take pending commands from the game and start them in order.
+ *
+ */
+void sound_read_queue(void)
+{
+    // Only the game moves the head
+    uint8_t head = SOUND_INDEX_LOAD(sound_queue_head);
+    uint8_t tail = sound_queue_tail;
+
+    for (; tail != head; tail++)
+    {
+        const SoundCommand *command =
+            &sound_queue[tail & (SOUND_QUEUE_SIZE - 1)];
+
+        SOUND_TRACE(command, true);
+        sound_start(command);
+    }
+
+    SOUND_INDEX_STORE(sound_queue_tail, tail);
+}
+
+/**
+ * @brief SOUND assign a voice to a new sound, restarting the same sound,
+ * otherwise taking a free voice, otherwise stealing the lowest priority voice
+ * closest to its end.
+ *
+ * @param command Sound to start
+ */
+void sound_start(const SoundCommand *command)
+{
+    SoundVoice *voice = NULL;
 
-    // After (1/140)s period increment sound index
-    uint32_t sound_t1 = platform_millis();
-    if ((sound_t1 - sound_t0) > 7)
+    // Restart the same sound, so repeated effects do not take every voice
+    for (uint8_t i = 0; (i < SOUND_VOICES) && (voice == NULL); i++)
+        if ((sound_voices[i].snd == command->snd) &&
+            (sound_voices[i].idx < sound_voices[i].len))
+            voice = &sound_voices[i];
+
+    for (uint8_t i = 0; (i < SOUND_VOICES) && (voice == NULL); i++)
+        if (sound_voices[i].idx >= sound_voices[i].len)
+            voice = &sound_voices[i];
+
+    if (voice == NULL)
+    {
+        for (uint8_t i = 0; i < SOUND_VOICES; i++)
+        {
+            SoundVoice *steal = &sound_voices[i];
+
+            if (steal->priority > command->priority)
+                continue;
+
+            if ((voice == NULL) || (steal->priority < voice->priority) ||
+                ((steal->priority == voice->priority) &&
+                 (steal->len - steal->idx < voice->len - voice->idx)))
+                voice = steal;
+        }
+    }
+
+    // Every voice plays a more important sound
+    if (voice == NULL)
+        return;
+
+    voice->snd = command->snd;
+    voice->len = command->len;
+    voice->idx = 0;
+    voice->priority = command->priority;
+    voice->step = 0;
+    voice->clock = 0;
+    voice->pattern = command->pattern;
+    voice->loop = command->loop;
+
+    // Load the first note
+    if (voice->pattern)
+    {
+        voice->pos = 0;
+        voice->repeats = 0;
+        voice->ticks = 1;
+        sound_pattern_next(voice);
+    }
+
+#ifdef SOUND_PCM_CACHE
+    // Sounds outside of sound.h are synthesized
+    voice->pcm = NULL;
+    for (uint8_t i = 0; i < SOUND_CACHE_SOUNDS; i++)
+    {
+        if ((sound_cache[i].snd == command->snd) &&
+            (sound_cache[i].len == command->len))
+        {
+            voice->pcm = &sound_cache_pcm[sound_cache[i].offset];
+            voice->frames = sound_cache[i].frames;
+            break;
+        }
+    }
+#endif
+}
+
+/**
+ * @brief SOUND synthesize a voice and add it to PCM buffer.
+ *
+ * @param voice  Sound voice
+ * @param buffer Signed 16-bit mono samples
+ * @param frames Number of samples
+ * @param rate   Sampling rate in Hz
+ * @return uint32_t Number of samples played before the sound ended
+ */
+uint32_t sound_synth_voice(SoundVoice *voice, int16_t *buffer,
+                           uint32_t frames, uint32_t rate)
+{
+    uint32_t i = 0;
+
+    while ((i < frames) && (voice->idx < voice->len))
+    {
+        // Mix up to the end of the step or of the buffer
+        uint32_t step_end = ((voice->step + 1) * rate + SOUND_STEP_RATE - 1) /
+                            SOUND_STEP_RATE;
+        uint32_t count = MIN(step_end - voice->clock, frames - i);
+        uint16_t frequency = sound_voice_frequency(voice);
+
+        if (frequency != 0)
+            sound_mix_square(&buffer[i], count, frequency, rate,
+                             &voice->phase);
+
+        i += count;
+        voice->clock += count;
+        if (voice->clock >= step_end)
+            sound_voice_next(voice);
+    }
+
+    return i;
+}
+
+/**
+ * @brief SOUND move a voice to its next step.
+ * @details Steps and samples are counted from the start of the current second,
+ * SOUND_STEP_RATE steps being exactly rate samples, so looping patterns play
+ * forever without overflow or drift.
+ *
+ * @param voice Sound voice
+ */
+void sound_voice_next(SoundVoice *voice)
+{
+    if (++voice->step >= SOUND_STEP_RATE)
+    {
+        voice->step = 0;
+        voice->clock = 0;
+    }
+
+    if (voice->pattern)
+        sound_pattern_next(voice);
+    else
+        voice->idx++;
+}
+
+/**
+ * @brief SOUND move a pattern voice to its next step, holding the current
+ * note or reading events up to the next one, in constant time.
+ *
+ * @param voice Sound voice
+ */
+void sound_pattern_next(SoundVoice *voice)
+{
+    if (--voice->ticks > 0)
+        return;
+
+    for (uint8_t i = 0; i < SOUND_PATTERN_MAX_COMMANDS; i++)
     {
-        sound_idx++;
-        sound_t0 = sound_t1;
+        uint8_t value = voice->snd[voice->pos];
+        uint8_t ticks = voice->snd[voice->pos + 1];
+
+        if (ticks != 0)
+        {
+            voice->value = value;
+            voice->ticks = ticks;
+            voice->pos += 2;
+            return;
+        }
+
+        if (value == 0x00)
+        {
+            if (!voice->loop)
+                break;
+
+            voice->pos = 0;
+            voice->repeats = 0;
+            continue;
+        }
+
+        // Start counting repetitions the first time the command is read
+        if (voice->repeats == 0)
+            voice->repeats = (value & 0x0f) + 1;
+
+        if (--voice->repeats > 0)
+            voice->pos -= (value >> 4) * 2;
+        else
+            voice->pos += 2;
+    }
+
+    // Pattern ended
+    voice->idx = voice->len;
+}
+
+#ifdef SOUND_PCM_CACHE
+/**
+ * @brief SOUND render every sound of sound.h into the PCM cache.
+ *
+ */
+void sound_cache_init(void)
+{
+    uint32_t offset = 0;
+
+    for (uint8_t i = 0; i < SOUND_CACHE_SOUNDS; i++)
+    {
+        SoundVoice voice = {.snd = sound_cache[i].snd,
+                            .len = sound_cache[i].len};
+
+        sound_cache[i].offset = offset;
+        sound_cache[i].frames = sound_synth_voice(
+            &voice, &sound_cache_pcm[offset], SOUND_CACHE_FRAMES - offset,
+            SOUND_CACHE_RATE);
+        offset += sound_cache[i].frames;
     }
+}
+
+/**
+ * @brief SOUND add the cached samples of a voice to PCM buffer.
+ *
+ * @param voice  Sound voice
+ * @param buffer Signed 16-bit mono samples
+ * @param frames Number of samples
+ * @return uint32_t Number of samples played before the sound ended
+ */
+uint32_t sound_cache_voice(SoundVoice *voice, int16_t *buffer,
+                           uint32_t frames)
+{
+    uint32_t count = MIN(frames, voice->frames - voice->clock);
+    const int16_t *pcm = &voice->pcm[voice->clock];
+
+    for (uint32_t i = 0; i < count; i++)
+        buffer[i] += pcm[i];
+
+    // Keep the step for sound_get_frequency, sample c is in step
+    // floor(c * SOUND_STEP_RATE / rate)
+    voice->clock += count;
+    voice->idx = (voice->clock >= voice->frames)
+                     ? voice->len
+                     : voice->clock * SOUND_STEP_RATE / SOUND_CACHE_RATE;
+
+    return count;
+}
+#endif
+
+/**
+ * @brief SOUND get frequency of the current step of a voice. Return zero if
+ * sound is finished or paused.
+ *
+ * @param voice Sound voice
+ * @return uint16_t Current voice frequency
+ */
+uint16_t sound_voice_frequency(const SoundVoice *voice)
+{
+    // Return zero if sound is finished
+    if (voice->idx >= voice->len)
+        return 0;
+
+    uint8_t value = voice->pattern ? voice->value : voice->snd[voice->idx];
 
     // Pause sound
-    if (sound_ptr[sound_idx] == 0x00)
+    if (value == 0x00)
         return 0;
 
     // Get frequency value from byte encoding
-    return 1193181 / (60 * (uint16_t)sound_ptr[sound_idx]);
+    return 1193181 / (60 * (uint16_t)value);
+}
+
+/**
+ * @brief SOUND add a square wave to PCM buffer for speaker emulation.
+ * @details Phase accumulator oscillator, a 32-bit phase wraps once per
+ * period, so the wave continues across buffers and the phase step is the
+ * only division per buffer.
+ *
+ * @param buffer    Signed 16-bit mono samples
+ * @param frames    Number of samples
+ * @param frequency Square wave frequency in Hz
+ * @param rate      Sampling rate in Hz
+ * @param phase     Oscillator phase, updated for the next buffer
+ */
+void sound_mix_square(int16_t *buffer, uint32_t frames, uint16_t frequency,
+                      uint32_t rate, uint32_t *phase)
+{
+    uint32_t step = ((uint64_t)frequency << 32) / rate;
+    uint32_t acc = *phase;
+
+    // High in the first half of the period, low in the second one
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        buffer[i] += (acc & 0x80000000) ? -SOUND_AMPLITUDE : SOUND_AMPLITUDE;
+        acc += step;
+    }
+
+    *phase = acc;
 }
 
 /* -------------------------------------------------------------------------- */
\ No newline at end of file
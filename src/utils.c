@@ -17,6 +17,17 @@ uint32_t millis(void)
     return platform_millis();
 }
 
+/**
+ * @brief UTILS get time in microseconds from start of execution, wrapping
+ * around every 71 minutes.
+ * 
+ * @return uint32_t Start time in microseconds
+ */
+uint32_t micros(void)
+{
+    return platform_micros();
+}
+
 /**
  * @brief UTILS apply blocking delay in milliseconds.
  * 
@@ -0,0 +1,298 @@
+/**
+ * @brief BENCH host microbenchmarks of the game hot paths.
+ *
+ * Each benchmark runs the code of the game on the host, built with the game
+ * optimization flags, and reports the mean time per operation. Results of the
+ * compared variants are checked against each other, so a faster variant that
+ * changes the outcome is reported.
+ *
+ * Usage:
+ *   bench
+ */
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "constants.h"
+#include "coords.h"
+#include "platform.h"
+#include "sound.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+#define BENCH_POINTS 4096
+#define BENCH_PASSES 256
+
+#define BENCH_RATE    44100
+#define BENCH_BLOCK   512
+#define BENCH_BLOCKS  4096
+#define BENCH_SQUARE  129
+
+/* Sounds looped by the voice benchmark, one per voice */
+#define BENCH_VOICE_PATTERNS {mus_s1_pat, get_key_pat, medkit_pat, shot_pat}
+
+/* Frames per sound_render_pwm call, and PWM timer period */
+#define BENCH_PWM_SIZES  {1, 32, 256, 1024}
+#define BENCH_PWM_PERIOD 1000
+
+/* Function prototypes ------------------------------------------------------ */
+
+static bool bench_distance(void);
+static bool bench_square(void);
+static bool bench_voices(void);
+static bool bench_pwm(void);
+static double bench_seconds(void);
+static float bench_random(float max);
+
+/* Global variables --------------------------------------------------------- */
+
+static uint32_t bench_seed = 1;
+
+/* Function definitions ----------------------------------------------------- */
+
+int main(void)
+{
+    bool valid = true;
+
+    valid &= bench_distance();
+    valid &= bench_square();
+    valid &= bench_voices();
+    valid &= bench_pwm();
+
+    return valid ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief BENCH entity distance threshold check, with the square root against
+ * the squared distance.
+ *
+ * @return bool Both checks agree
+ */
+bool bench_distance(void)
+{
+    static Coords point[BENCH_POINTS];
+    Coords player = {16.0f, 16.0f};
+
+    // Entities anywhere in a 32x32 level
+    for (uint16_t i = 0; i < BENCH_POINTS; i++)
+        point[i] = (Coords){bench_random(32.0f), bench_random(32.0f)};
+
+    uint32_t near = 0;
+    double start = bench_seconds();
+    for (uint16_t pass = 0; pass < BENCH_PASSES; pass++)
+        for (uint16_t i = 0; i < BENCH_POINTS; i++)
+            near += coords_get_distance(&player, &point[i]) < MAX_ENEMY_VIEW;
+    double sqrt_time = bench_seconds() - start;
+
+    uint32_t near_sq = 0;
+    start = bench_seconds();
+    for (uint16_t pass = 0; pass < BENCH_PASSES; pass++)
+        for (uint16_t i = 0; i < BENCH_POINTS; i++)
+            near_sq += coords_get_distance_sq(&player, &point[i]) <
+                       MAX_ENEMY_VIEW_SQ;
+    double sq_time = bench_seconds() - start;
+
+    uint32_t checks = (uint32_t)BENCH_POINTS * BENCH_PASSES;
+    printf("distance: %u checks, sqrt %.2f ns, squared %.2f ns, "
+           "%u against %u in view\n",
+           checks, sqrt_time * 1e9 / checks, sq_time * 1e9 / checks, near,
+           near_sq);
+
+    return near == near_sq;
+}
+
+/**
+ * @brief BENCH speaker square wave, with the phase accumulator of
+ * sound_mix_square against the former modulo per sample loop, which restarted
+ * the wave at every buffer.
+ *
+ * @return bool Half periods of the accumulator stay within one sample across
+ * buffers
+ */
+bool bench_square(void)
+{
+    static int16_t buffer[BENCH_BLOCKS][BENCH_BLOCK];
+    uint32_t phase = 0;
+
+    // Fault the buffer in before timing
+    memset(buffer, 0, sizeof(buffer));
+
+    double start = bench_seconds();
+    for (uint16_t i = 0; i < BENCH_BLOCKS; i++)
+    {
+        memset(buffer[i], 0, sizeof(buffer[i]));
+        sound_mix_square(buffer[i], BENCH_BLOCK, BENCH_SQUARE, BENCH_RATE,
+                         &phase);
+    }
+    double acc_time = bench_seconds() - start;
+
+    // Edges of the continuous wave, the first half period may be cut
+    uint32_t min_half = UINT32_MAX;
+    uint32_t max_half = 0;
+    uint32_t last_edge = 0;
+    int16_t *sample = &buffer[0][0];
+    for (uint32_t i = 1; i < BENCH_BLOCKS * BENCH_BLOCK; i++)
+    {
+        if (sample[i] == sample[i - 1])
+            continue;
+
+        if (last_edge > 0)
+        {
+            min_half = MIN(min_half, i - last_edge);
+            max_half = MAX(max_half, i - last_edge);
+        }
+        last_edge = i;
+    }
+
+    start = bench_seconds();
+    for (uint16_t i = 0; i < BENCH_BLOCKS; i++)
+    {
+        uint16_t wave_length = BENCH_RATE / BENCH_SQUARE;
+        for (uint16_t j = 0; j < BENCH_BLOCK; j++)
+            buffer[i][j] = (j % wave_length) < (wave_length / 2)
+                               ? SOUND_AMPLITUDE
+                               : -SOUND_AMPLITUDE;
+    }
+    double mod_time = bench_seconds() - start;
+
+    uint32_t samples = (uint32_t)BENCH_BLOCKS * BENCH_BLOCK;
+    printf("square: %u samples at %u Hz, accumulator %.0f samples/us, "
+           "modulo %.0f samples/us, half periods %u-%u samples (%.1f)\n",
+           samples, BENCH_SQUARE, samples / acc_time / 1e6,
+           samples / mod_time / 1e6, min_half, max_half,
+           (double)BENCH_RATE / BENCH_SQUARE / 2);
+
+    return max_half - min_half <= 1;
+}
+
+/**
+ * @brief BENCH sound_render mixing from no voice up to SOUND_VOICES looped
+ * sounds.
+ *
+ * @return bool Mix of every voice stays in the sample range
+ */
+bool bench_voices(void)
+{
+    static int16_t buffer[BENCH_BLOCK];
+    const uint8_t *pattern[SOUND_VOICES] = BENCH_VOICE_PATTERNS;
+    int32_t peak = 0;
+
+    printf("voices: %u blocks of %u samples, ns/sample", BENCH_BLOCKS,
+           BENCH_BLOCK);
+
+    for (uint8_t voices = 0; voices <= SOUND_VOICES; voices++)
+    {
+        sound_init();
+        for (uint8_t v = 0; v < voices; v++)
+            sound_play_pattern(pattern[v], 0, true, true);
+
+        // Only the rendering is timed, not the peak search
+        double time = 0.0;
+        for (uint16_t i = 0; i < BENCH_BLOCKS; i++)
+        {
+            double start = bench_seconds();
+            sound_render(buffer, BENCH_BLOCK, BENCH_RATE);
+            time += bench_seconds() - start;
+
+            for (uint16_t j = 0; j < BENCH_BLOCK; j++)
+                peak = MAX(peak, abs(buffer[j]));
+        }
+
+        printf(" %u: %.2f", voices,
+               time * 1e9 / ((uint32_t)BENCH_BLOCKS * BENCH_BLOCK));
+    }
+
+    printf(", peak %d\n", (int)peak);
+
+    return peak <= SOUND_VOICES * SOUND_AMPLITUDE;
+}
+
+/**
+ * @brief BENCH sound_render_pwm with two looped voices, from per sample calls
+ * up to DMA sized blocks.
+ *
+ * @return bool Silence is half the period and every duty value is in range
+ */
+bool bench_pwm(void)
+{
+    static uint16_t duty[BENCH_BLOCKS * BENCH_BLOCK];
+    const uint32_t sizes[] = BENCH_PWM_SIZES;
+    uint32_t frames = BENCH_BLOCKS * BENCH_BLOCK;
+    uint16_t min_duty = UINT16_MAX;
+    uint16_t max_duty = 0;
+
+    // Silence before any sound, faulting the buffer in before timing
+    sound_init();
+    sound_render_pwm(duty, frames, BENCH_RATE, BENCH_PWM_PERIOD);
+    uint16_t silence = duty[0];
+
+    printf("pwm: %u samples, 2 voices, ns/sample", frames);
+
+    for (uint8_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+    {
+        sound_init();
+        sound_play_pattern(mus_s1_pat, 0, true, true);
+        sound_play_pattern(get_key_pat, 0, true, true);
+
+        double start = bench_seconds();
+        for (uint32_t i = 0; i + sizes[s] <= frames; i += sizes[s])
+            sound_render_pwm(&duty[i], sizes[s], BENCH_RATE,
+                             BENCH_PWM_PERIOD);
+        double time = bench_seconds() - start;
+
+        for (uint32_t i = 0; i < frames; i++)
+        {
+            min_duty = MIN(min_duty, duty[i]);
+            max_duty = MAX(max_duty, duty[i]);
+        }
+
+        printf(" %u: %.2f", sizes[s], time * 1e9 / frames);
+    }
+
+    printf(", silence %u, duty %u-%u of %u\n", silence, min_duty, max_duty,
+           BENCH_PWM_PERIOD);
+
+    return (silence == BENCH_PWM_PERIOD / 2) && (max_duty <= BENCH_PWM_PERIOD);
+}
+
+/**
+ * @brief BENCH get monotonic time.
+ *
+ * @return double Time in seconds
+ */
+double bench_seconds(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief BENCH get repeatable pseudo random value.
+ *
+ * @param max Upper bound
+ * @return float Value from 0 to max
+ */
+float bench_random(float max)
+{
+    bench_seed = bench_seed * 1664525 + 1013904223;
+
+    return (bench_seed >> 8) * max / (1 << 24);
+}
+
+/**
+ * @brief BENCH headless platform, sounds are rendered without audio device.
+ *
+ */
+void platform_audio_play(void)
+{
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,227 @@
+/**
+ * @brief CLOCKWRAP host check of frame timing across clock wraparounds.
+ *
+ * Runs display_delay_fps of display.c on a virtual clock instead of the
+ * platform one. The nanosecond clock starts a few frames before the 32-bit
+ * microsecond clock wraps, and microseconds are derived from it as the raylib
+ * platform does. Every frame lasts one period plus some jitter, and must give
+ * the same delta_time and anim_time steps before, across and after the wrap.
+ *
+ * The animation periods are also checked to divide ANIM_PERIOD_US, so the
+ * gun jogging and the enemy walk frames continue when anim_time wraps.
+ *
+ * Usage:
+ *   clockwrap
+ */
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include "constants.h"
+#include "display.h"
+#include "platform.h"
+#include "utils.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+#define CLOCKWRAP_FRAMES       1000
+#define CLOCKWRAP_FRAMES_AHEAD 10
+#define CLOCKWRAP_JITTER_US    1000
+#define CLOCKWRAP_JITTER_STEPS 7
+
+/* Function prototypes ------------------------------------------------------ */
+
+static bool clockwrap_frames(void);
+static bool clockwrap_animations(void);
+
+/* Global variables --------------------------------------------------------- */
+
+static uint64_t clockwrap_ns;
+static uint32_t clockwrap_frame_us;
+
+/* Function definitions ----------------------------------------------------- */
+
+int main(void)
+{
+    bool valid = true;
+
+    valid &= clockwrap_frames();
+    valid &= clockwrap_animations();
+
+    return valid ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief CLOCKWRAP run frames across the microsecond clock wrap.
+ *
+ * @return bool Every frame gives the expected delta_time and anim_time step
+ */
+bool clockwrap_frames(void)
+{
+    uint32_t wrap_frame = UINT32_MAX;
+    uint32_t errors = 0;
+    float min_delta = INFINITY;
+    float max_delta = 0.0f;
+
+    display_init();
+
+    // Frames ahead of the wrap, the first one syncs the frame time
+    clockwrap_ns = ((1ULL << 32) - CLOCKWRAP_FRAMES_AHEAD * FRAME_TIME_US) *
+                   1000;
+    clockwrap_frame_us = FRAME_TIME_US;
+    display_delay_fps();
+
+    for (uint32_t i = 0; i < CLOCKWRAP_FRAMES; i++)
+    {
+        uint32_t before = micros();
+        uint32_t anim_before = anim_time;
+
+        clockwrap_frame_us = FRAME_TIME_US +
+                             (i % CLOCKWRAP_JITTER_STEPS) * CLOCKWRAP_JITTER_US;
+        display_delay_fps();
+
+        if ((micros() < before) && (wrap_frame == UINT32_MAX))
+            wrap_frame = i;
+
+        float delta = (float)clockwrap_frame_us / FRAME_TIME_US;
+        uint32_t anim_step = (anim_time + ANIM_PERIOD_US - anim_before) %
+                             ANIM_PERIOD_US;
+
+        if ((fabsf(delta_time - delta) > 1e-6f) ||
+            (anim_step != clockwrap_frame_us) || (anim_time >= ANIM_PERIOD_US))
+        {
+            if (errors++ == 0)
+                fprintf(stderr,
+                        "frame %u: delta_time %f instead of %f, anim_time "
+                        "step %u instead of %u\n",
+                        i, (double)delta_time, (double)delta, anim_step,
+                        clockwrap_frame_us);
+        }
+
+        min_delta = MIN(min_delta, delta_time);
+        max_delta = MAX(max_delta, delta_time);
+    }
+
+    printf("frames: %u frames, micros wrapped at frame %u, delta_time "
+           "%.4f-%.4f, %u errors\n",
+           CLOCKWRAP_FRAMES, wrap_frame, (double)min_delta, (double)max_delta,
+           errors);
+
+    return (errors == 0) && (wrap_frame != UINT32_MAX);
+}
+
+/**
+ * @brief CLOCKWRAP check the animations continue across the anim_time wrap.
+ *
+ * @return bool Animation periods divide ANIM_PERIOD_US
+ */
+bool clockwrap_animations(void)
+{
+    // Last walk frame before the wrap, then first one after it
+    uint8_t walk_before = ((ANIM_PERIOD_US - 1) / ENEMY_WALK_FRAME_US) % 2;
+    uint8_t walk_after = (0 / ENEMY_WALK_FRAME_US) % 2;
+
+    // Jogging phase on both sides of the wrap, as in game_render_gun
+    float jog_before = sinf(ANIM_PERIOD_US * (2 * PI / JOGGING_PERIOD_US));
+    float jog_after = sinf(0 * (2 * PI / JOGGING_PERIOD_US));
+
+    bool valid = (ANIM_PERIOD_US % (2 * ENEMY_WALK_FRAME_US) == 0) &&
+                 (ANIM_PERIOD_US % JOGGING_PERIOD_US == 0) &&
+                 (walk_before != walk_after) &&
+                 (fabsf(jog_before - jog_after) < 1e-3f);
+
+    printf("animations: walk frame %u then %u, jogging %.4f then %.4f "
+           "across the anim_time wrap, %s\n",
+           walk_before, walk_after, (double)jog_before, (double)jog_after,
+           valid ? "continuous" : "discontinuous");
+
+    return valid;
+}
+
+/**
+ * @brief CLOCKWRAP virtual monotonic time, see platform.c.
+ *
+ * @return uint64_t Time in nanoseconds
+ */
+uint64_t platform_nanos(void)
+{
+    return clockwrap_ns;
+}
+
+/**
+ * @brief CLOCKWRAP virtual time, truncated from nanoseconds as on raylib.
+ *
+ * @return uint32_t Time in microseconds
+ */
+uint32_t platform_micros(void)
+{
+    return (uint32_t)(platform_nanos() / 1000);
+}
+
+/**
+ * @brief CLOCKWRAP virtual time in milliseconds.
+ *
+ * @return uint32_t Time in milliseconds
+ */
+uint32_t platform_millis(void)
+{
+    return platform_nanos() / 1000000;
+}
+
+/**
+ * @brief CLOCKWRAP move the virtual clock to the end of the current frame.
+ *
+ * @param period_us Frame period in microseconds, jitter is added
+ */
+void platform_wait_frame(uint32_t period_us)
+{
+    (void)period_us;
+    clockwrap_ns += (uint64_t)clockwrap_frame_us * 1000;
+}
+
+/**
+ * @brief CLOCKWRAP move the virtual clock by a delay.
+ *
+ * @param ms Delay in milliseconds
+ */
+void platform_delay(uint32_t ms)
+{
+    clockwrap_ns += (uint64_t)ms * 1000000;
+}
+
+/**
+ * @brief CLOCKWRAP headless platform, nothing is drawn.
+ *
+ */
+void platform_draw_start(void)
+{
+}
+
+/**
+ * @brief CLOCKWRAP headless platform, nothing is drawn.
+ *
+ */
+void platform_draw_stop(void)
+{
+}
+
+/**
+ * @brief CLOCKWRAP headless platform, nothing is drawn.
+ *
+ * @param x     X coordinate
+ * @param y     Y coordinate
+ * @param color Pixel color
+ */
+void platform_draw_pixel(uint8_t x, uint8_t y, bool color)
+{
+    (void)x;
+    (void)y;
+    (void)color;
+}
+
+/* -------------------------------------------------------------------------- */
@@ -0,0 +1,1177 @@
+/**
+ * @brief LEVELC host level compiler.
+ *
+ * Compiles text level sources into the binary format described in level.h,
+ * precomputing everything the game would otherwise scan the map for: the
+ * spawn list (sorted by tile, player index in the header), the trigger list
+ * with its chunk index, the solid tiles bitset and the potentially visible
+ * set of every cell.
+ *
+ * Source format, lines starting with '#' are comments:
+ *
+ *   trigger <x0> <y0> <x1> <y1> <action> <param> <x> <y> [kills]
+ *
+ * Actions are spawn, teleport, boss and exit, see LevelTriggerAction.
+ *   map
+ *   <one hexadecimal entity type per tile, top row first>
+ *
+ * Episode manifests list levels in play order, sources being relative to the
+ * manifest and named after their first EPISODE_NAME_SIZE characters:
+ *
+ *   level <source.txt> <kill goal> <intro|mid|end>
+ *
+ * The kill goal is 0 for levels ending at an exit trigger, the last field is
+ * the cutscene shown when the level is completed, see EpisodeCutscene.
+ *
+ * Usage, -z compresses map chunks, -p packs the levels of an episode:
+ *   levelc [-z] -o <output.lvl> <source.txt>
+ *   levelc [-z] -c -o <output.h> <source.txt>...
+ *   levelc [-z] -p -o <output.pak> <manifest.episode>
+ *   levelc [-z] -p -c -o <output.h> <manifest.episode>...
+ */
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Built-in levels are not needed here, and may not be generated yet
+#define LEVEL_NO_DATA
+#include "episode.h"
+#include "level.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+#define LEVELC_LINE_SIZE    (LEVEL_MAX_WIDTH + 2)
+#define LEVELC_MAX_SPAWNS   MAX_SPAWN_POINTS
+#define LEVELC_MAX_TRIGGERS 256
+#define LEVELC_BYTES_LINE   12
+#define LEVELC_MAX_LEVELS   UINT8_MAX
+#define LEVELC_PATH_SIZE    4096
+
+/* Rays are cast between the center and points near the corners of floor
+ * tiles */
+#define LEVELC_PVS_SAMPLES 5
+#define LEVELC_PVS_INSET   0.05f
+#define LEVELC_CELL_SIZE   (1 << LEVEL_PVS_BASE)
+
+/* Data types --------------------------------------------------------------- */
+
+typedef struct
+{
+    uint16_t width;
+    uint16_t height;
+    uint8_t *tiles;
+    uint16_t num_triggers;
+    LevelTrigger trigger[LEVELC_MAX_TRIGGERS];
+} LevelSource;
+
+typedef struct
+{
+    uint8_t *data;
+    uint32_t size;
+    uint32_t map;
+    uint32_t spawns;
+    uint32_t triggers;
+    uint32_t solid;
+    uint32_t index;
+    uint32_t pvs;
+} LevelOutput;
+
+typedef struct
+{
+    char source[LEVELC_PATH_SIZE];
+    char name[EPISODE_NAME_SIZE + 1];
+    uint8_t kill_goal;
+    uint8_t cutscene;
+} EpisodeEntry;
+
+typedef struct
+{
+    uint8_t num_levels;
+    EpisodeEntry level[LEVELC_MAX_LEVELS];
+} EpisodeSource;
+
+/* Function prototypes ------------------------------------------------------ */
+
+static bool levelc_parse(const char *path, LevelSource *src);
+static bool levelc_parse_episode(const char *path, EpisodeSource *episode);
+static bool levelc_build(const char *path, bool compress, LevelOutput *out);
+static bool levelc_pack(const EpisodeSource *episode, const LevelOutput *level,
+                        LevelOutput *out);
+static bool levelc_compile(const LevelSource *src, LevelOutput *out);
+static void levelc_compress(LevelOutput *out);
+static uint8_t levelc_compress_chunk(const uint8_t *map, uint8_t *data);
+static bool levelc_parse_trigger(const char *line, LevelTrigger *trigger);
+static void levelc_compute_pvs(const LevelSource *src, uint8_t *pvs);
+static bool levelc_is_cell_visible(const LevelSource *src, int32_t cell_x0,
+                                   int32_t cell_y0, int32_t cell_x1,
+                                   int32_t cell_y1);
+static bool levelc_trace_ray(const LevelSource *src, float x0, float y0,
+                             float x1, float y1);
+static bool levelc_is_floor(const LevelSource *src, int32_t x, int32_t y);
+static bool levelc_is_spawn(uint8_t type);
+static bool levelc_is_solid(uint8_t type);
+static void levelc_write_u16(uint8_t *data, uint16_t value);
+static void levelc_write_u32(uint8_t *data, uint32_t value);
+static bool levelc_write_binary(const char *path, const LevelOutput *out);
+static void levelc_write_array(FILE *file, const char *path,
+                               const LevelOutput *out);
+static void levelc_write_episode_array(FILE *file, const char *path,
+                                       const EpisodeSource *episode,
+                                       const LevelOutput *level,
+                                       const LevelOutput *out);
+static void levelc_write_sections(FILE *file, const char *header,
+                                  const LevelOutput *out, bool first);
+static void levelc_write_bytes(FILE *file, const char *section,
+                               const uint8_t *data, uint32_t size,
+                               bool first);
+
+/* Function definitions ----------------------------------------------------- */
+
+int main(int argc, char *argv[])
+{
+    bool c_array = false;
+    bool compress = false;
+    bool pack = false;
+    const char *output = NULL;
+    int first = argc;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "-c") == 0)
+        {
+            c_array = true;
+        }
+        else if (strcmp(argv[i], "-z") == 0)
+        {
+            compress = true;
+        }
+        else if (strcmp(argv[i], "-p") == 0)
+        {
+            pack = true;
+        }
+        else if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc))
+        {
+            output = argv[++i];
+        }
+        else
+        {
+            first = i;
+            break;
+        }
+    }
+
+    if ((output == NULL) || (first >= argc) || (!c_array && (first + 1 != argc)))
+    {
+        fprintf(stderr,
+                "usage: levelc [-z] -o <output.lvl> <source.txt>\n"
+                "       levelc [-z] -c -o <output.h> <source.txt>...\n"
+                "       levelc [-z] -p -o <output.pak> <manifest.episode>\n"
+                "       levelc [-z] -p -c -o <output.h> "
+                "<manifest.episode>...\n");
+        return EXIT_FAILURE;
+    }
+
+    FILE *file = NULL;
+    if (c_array)
+    {
+        file = fopen(output, "w");
+        if (file == NULL)
+        {
+            perror(output);
+            return EXIT_FAILURE;
+        }
+
+        fprintf(file,
+                "/* Generated by tools/levelc.c from levels/, do not edit */\n"
+                "\n"
+                "/* Header guard "
+                "------------------------------------------------------------- */\n"
+                "\n"
+                "#ifndef LEVEL_DATA_H\n"
+                "#define LEVEL_DATA_H\n"
+                "\n"
+                "/* Includes "
+                "----------------------------------------------------------------- */\n"
+                "\n"
+                "#include <stdint.h>\n");
+    }
+
+    bool valid = true;
+    for (int i = first; (i < argc) && valid; i++)
+    {
+        if (!pack)
+        {
+            LevelOutput out;
+
+            valid = levelc_build(argv[i], compress, &out);
+            if (valid && c_array)
+                levelc_write_array(file, argv[i], &out);
+            else if (valid)
+                valid = levelc_write_binary(output, &out);
+
+            if (valid)
+                free(out.data);
+            continue;
+        }
+
+        static EpisodeSource episode;
+        static LevelOutput level[LEVELC_MAX_LEVELS];
+        LevelOutput out;
+        uint8_t built = 0;
+
+        valid = levelc_parse_episode(argv[i], &episode);
+        while (valid && (built < episode.num_levels))
+        {
+            valid = levelc_build(episode.level[built].source, compress,
+                                 &level[built]);
+            if (valid)
+                built++;
+        }
+
+        if (valid && levelc_pack(&episode, level, &out))
+        {
+            if (c_array)
+                levelc_write_episode_array(file, argv[i], &episode, level,
+                                           &out);
+            else
+                valid = levelc_write_binary(output, &out);
+
+            printf("%s: %u levels, %u bytes\n", argv[i], episode.num_levels,
+                   out.size);
+            free(out.data);
+        }
+
+        for (uint8_t j = 0; j < built; j++)
+            free(level[j].data);
+    }
+
+    if (c_array)
+    {
+        fprintf(file,
+                "\n#endif /* LEVEL_DATA_H */\n"
+                "\n/* "
+                "-------------------------------------------------------------"
+                "------------- */\n");
+        fclose(file);
+    }
+
+    return valid ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief LEVELC parse, compile and optionally compress a level source.
+ *
+ * @param path     Source path
+ * @param compress Compress map chunks
+ * @param out      Compiled level
+ * @return bool Source is valid
+ */
+bool levelc_build(const char *path, bool compress, LevelOutput *out)
+{
+    static LevelSource src;
+    src.tiles = NULL;
+
+    if (!levelc_parse(path, &src) || !levelc_compile(&src, out))
+    {
+        free(src.tiles);
+        return false;
+    }
+
+    uint32_t map_size = out->spawns - out->map;
+    if (compress)
+        levelc_compress(out);
+
+    printf("%s: %ux%u, %u bytes, map %u/%u bytes, %u spawns, "
+           "%u triggers\n",
+           path, src.width, src.height, out->size,
+           out->spawns - out->map, map_size,
+           (out->triggers - out->spawns) / LEVEL_SPAWN_SIZE,
+           src.num_triggers);
+
+    free(src.tiles);
+    return true;
+}
+
+/**
+ * @brief LEVELC parse episode manifest.
+ *
+ * @param path    Manifest path
+ * @param episode Parsed episode
+ * @return bool Manifest is valid
+ */
+bool levelc_parse_episode(const char *path, EpisodeSource *episode)
+{
+    static const char *const cutscenes[] = {"intro", "mid", "end"};
+
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        perror(path);
+        return false;
+    }
+
+    // Level sources are relative to the manifest directory
+    const char *name = strrchr(path, '/');
+    int dir_length = (name != NULL) ? (int)(name - path + 1) : 0;
+
+    char line[LEVELC_PATH_SIZE];
+    uint32_t line_number = 0;
+
+    memset(episode, 0x00, sizeof(EpisodeSource));
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        line_number++;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if ((line[0] == '#') || (line[0] == '\0'))
+            continue;
+
+        char source[256] = "";
+        char cutscene[8] = "";
+        unsigned int kill_goal = 0;
+        uint8_t num_cutscenes = sizeof(cutscenes) / sizeof(cutscenes[0]);
+        uint8_t id = num_cutscenes;
+
+        bool valid = (episode->num_levels < LEVELC_MAX_LEVELS) &&
+                     (sscanf(line, "level %255s %u %7s", source, &kill_goal,
+                             cutscene) == 3) &&
+                     (kill_goal <= UINT8_MAX);
+
+        for (uint8_t i = 0; i < num_cutscenes; i++)
+        {
+            if (strcmp(cutscene, cutscenes[i]) == 0)
+                id = i;
+        }
+
+        // Level name is the source name without extension
+        const char *level_name = strrchr(source, '/');
+        level_name = (level_name != NULL) ? level_name + 1 : source;
+        int name_length = strcspn(level_name, ".");
+
+        EpisodeEntry *entry = &episode->level[episode->num_levels];
+        if (!valid || (id == num_cutscenes) || (name_length == 0) ||
+            (name_length > EPISODE_NAME_SIZE) ||
+            (snprintf(entry->source, sizeof(entry->source), "%.*s%s",
+                      dir_length, path, source) >= LEVELC_PATH_SIZE))
+        {
+            fprintf(stderr, "%s:%u: invalid line\n", path, line_number);
+            fclose(file);
+            return false;
+        }
+
+        snprintf(entry->name, sizeof(entry->name), "%.*s", name_length,
+                 level_name);
+        entry->kill_goal = kill_goal;
+        entry->cutscene = id;
+        episode->num_levels++;
+    }
+
+    fclose(file);
+
+    if (episode->num_levels == 0)
+    {
+        fprintf(stderr, "%s: no levels\n", path);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief LEVELC pack compiled levels of an episode with their index.
+ *
+ * @param episode Parsed episode
+ * @param level   Compiled levels, in episode order
+ * @param out     Episode pack, only data and size are set
+ * @return bool Episode pack was built
+ */
+bool levelc_pack(const EpisodeSource *episode, const LevelOutput *level,
+                 LevelOutput *out)
+{
+    uint32_t offset = EPISODE_HEADER_SIZE +
+                      episode->num_levels * EPISODE_INDEX_SIZE;
+
+    memset(out, 0x00, sizeof(LevelOutput));
+    out->size = offset;
+    for (uint8_t i = 0; i < episode->num_levels; i++)
+        out->size += level[i].size;
+
+    out->data = calloc(out->size, 1);
+    if (out->data == NULL)
+        return false;
+
+    memcpy(out->data, EPISODE_MAGIC, 4);
+    out->data[4] = EPISODE_VERSION;
+    out->data[5] = episode->num_levels;
+
+    for (uint8_t i = 0; i < episode->num_levels; i++)
+    {
+        uint8_t *index = out->data + EPISODE_HEADER_SIZE +
+                         i * EPISODE_INDEX_SIZE;
+
+        levelc_write_u32(index, offset);
+        levelc_write_u32(index + 4, level[i].size);
+        memcpy(index + 8, episode->level[i].name,
+               strlen(episode->level[i].name));
+        index[8 + EPISODE_NAME_SIZE] = episode->level[i].kill_goal;
+        index[9 + EPISODE_NAME_SIZE] = episode->level[i].cutscene;
+
+        memcpy(out->data + offset, level[i].data, level[i].size);
+        offset += level[i].size;
+    }
+
+    return true;
+}
+
+/**
+ * @brief LEVELC parse level text source.
+ *
+ * @param path Source path
+ * @param src  Parsed level
+ * @return bool Source is valid
+ */
+bool levelc_parse(const char *path, LevelSource *src)
+{
+    FILE *file = fopen(path, "r");
+    if (file == NULL)
+    {
+        perror(path);
+        return false;
+    }
+
+    static char line[LEVELC_LINE_SIZE + 1];
+    bool in_map = false;
+    uint32_t line_number = 0;
+
+    memset(src, 0x00, sizeof(LevelSource));
+
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        line_number++;
+        line[strcspn(line, "\r\n")] = '\0';
+
+        if ((line[0] == '#') || (line[0] == '\0'))
+            continue;
+
+        if (!in_map)
+        {
+            if (strcmp(line, "map") == 0)
+            {
+                in_map = true;
+            }
+            else if ((src->num_triggers < LEVELC_MAX_TRIGGERS) &&
+                     levelc_parse_trigger(line,
+                                          &src->trigger[src->num_triggers]))
+            {
+                src->num_triggers++;
+            }
+            else
+            {
+                fprintf(stderr, "%s:%u: invalid line\n", path, line_number);
+                fclose(file);
+                return false;
+            }
+            continue;
+        }
+
+        size_t width = strlen(line);
+        if ((width == 0) || (width > LEVEL_MAX_WIDTH) ||
+            ((src->height > 0) && (width != src->width)) ||
+            (src->height >= LEVEL_MAX_HEIGHT))
+        {
+            fprintf(stderr, "%s:%u: invalid map row\n", path, line_number);
+            fclose(file);
+            return false;
+        }
+
+        src->width = width;
+        src->tiles = realloc(src->tiles, (size_t)(src->height + 1) * width);
+        for (size_t x = 0; x < width; x++)
+        {
+            char *end;
+            char digit[2] = {line[x], '\0'};
+            uint8_t type = strtoul(digit, &end, 16);
+            if (*end != '\0')
+            {
+                fprintf(stderr, "%s:%u: invalid tile '%c'\n", path,
+                        line_number, line[x]);
+                fclose(file);
+                return false;
+            }
+            src->tiles[(size_t)src->height * width + x] = type;
+        }
+        src->height++;
+    }
+
+    fclose(file);
+
+    if (src->height == 0)
+    {
+        fprintf(stderr, "%s: missing map\n", path);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief LEVELC compile parsed level into its binary format.
+ *
+ * @param src Parsed level
+ * @param out Compiled level
+ * @return bool Level is valid
+ */
+bool levelc_compile(const LevelSource *src, LevelOutput *out)
+{
+    uint16_t w = src->width;
+    uint16_t h = src->height;
+    uint16_t chunks_x = (w + LEVEL_CHUNK_SIZE - 1) >> LEVEL_CHUNK_BASE;
+    uint16_t chunks_y = (h + LEVEL_CHUNK_SIZE - 1) >> LEVEL_CHUNK_BASE;
+    uint16_t solid_stride = (w + 7) / 8;
+
+    // Source rows are stored from the top, the game Y axis goes up
+    #define LEVELC_TILE(x, y) \
+        (src->tiles[(size_t)(h - 1 - (y)) * w + (x)])
+
+    uint32_t num_spawns = 0;
+    int32_t player = -1;
+    for (uint16_t y = 0; y < h; y++)
+    {
+        for (uint16_t x = 0; x < w; x++)
+        {
+            if (!levelc_is_spawn(LEVELC_TILE(x, y)))
+                continue;
+            if (LEVELC_TILE(x, y) == E_PLAYER)
+                player = num_spawns;
+            num_spawns++;
+        }
+    }
+
+    if ((player < 0) || (num_spawns > LEVELC_MAX_SPAWNS))
+    {
+        fprintf(stderr, "level needs one player and at most %u spawns\n",
+                LEVELC_MAX_SPAWNS);
+        return false;
+    }
+
+    out->map = LEVEL_HEADER_SIZE;
+    out->spawns = out->map + (uint32_t)chunks_x * chunks_y * LEVEL_CHUNK_BYTES;
+    out->triggers = out->spawns + num_spawns * LEVEL_SPAWN_SIZE;
+    out->solid = out->triggers + src->num_triggers * LEVEL_TRIGGER_SIZE;
+    out->index = out->solid + (uint32_t)solid_stride * h;
+
+    // Trigger index lists every trigger overlapping each chunk
+    uint32_t num_chunks = (uint32_t)chunks_x * chunks_y;
+    uint32_t num_refs = 0;
+    for (uint16_t i = 0; i < src->num_triggers; i++)
+    {
+        const LevelTrigger *t = &src->trigger[i];
+        if ((t->x0 > t->x1) || (t->y0 > t->y1) || (t->x1 >= w) ||
+            (t->y1 >= h))
+        {
+            fprintf(stderr, "trigger %u is outside the map\n", i);
+            return false;
+        }
+        num_refs += ((t->x1 >> LEVEL_CHUNK_BASE) - (t->x0 >> LEVEL_CHUNK_BASE) +
+                     1) *
+                    ((t->y1 >> LEVEL_CHUNK_BASE) - (t->y0 >> LEVEL_CHUNK_BASE) +
+                     1);
+    }
+
+    if (num_refs > UINT16_MAX)
+    {
+        fprintf(stderr, "too many trigger index entries\n");
+        return false;
+    }
+
+    out->pvs = out->index + (num_chunks + 1) * 2 + num_refs * 2;
+
+    uint32_t num_cells =
+        (uint32_t)((w + LEVELC_CELL_SIZE - 1) >> LEVEL_PVS_BASE) *
+        ((h + LEVELC_CELL_SIZE - 1) >> LEVEL_PVS_BASE);
+    out->size = out->pvs + num_cells * LEVEL_PVS_BYTES;
+    out->data = calloc(out->size, 1);
+
+    uint8_t *header = out->data;
+    memcpy(header, LEVEL_MAGIC, 4);
+    header[4] = LEVEL_VERSION;
+    header[5] = LEVEL_FLAG_CHUNKED;
+    levelc_write_u16(header + 6, w);
+    levelc_write_u16(header + 8, h);
+    levelc_write_u16(header + 10, num_spawns);
+    levelc_write_u16(header + 12, src->num_triggers);
+    levelc_write_u16(header + 14, player);
+
+    uint8_t *spawn = out->data + out->spawns;
+    for (uint16_t y = 0; y < h; y++)
+    {
+        for (uint16_t x = 0; x < w; x++)
+        {
+            uint8_t type = LEVELC_TILE(x, y);
+
+            // Chunk major map, chunk rows from the bottom one
+            uint32_t chunk = (uint32_t)(y >> LEVEL_CHUNK_BASE) * chunks_x +
+                             (x >> LEVEL_CHUNK_BASE);
+            uint32_t tile = (y & (LEVEL_CHUNK_SIZE - 1)) * LEVEL_CHUNK_SIZE +
+                            (x & (LEVEL_CHUNK_SIZE - 1));
+            out->data[out->map + chunk * LEVEL_CHUNK_BYTES + tile / 2] |=
+                (x % 2) ? type : type << 4;
+
+            // Tiles are visited in spawn order, by row then column
+            if (levelc_is_spawn(type))
+            {
+                spawn[0] = type;
+                levelc_write_u16(spawn + 2, x);
+                levelc_write_u16(spawn + 4, y);
+                spawn += LEVEL_SPAWN_SIZE;
+            }
+
+            if (levelc_is_solid(type))
+                out->data[out->solid + (uint32_t)y * solid_stride + x / 8] |=
+                    0x80 >> (x % 8);
+        }
+    }
+
+    #undef LEVELC_TILE
+
+    for (uint16_t i = 0; i < src->num_triggers; i++)
+    {
+        const LevelTrigger *t = &src->trigger[i];
+        uint8_t *data = out->data + out->triggers + i * LEVEL_TRIGGER_SIZE;
+        levelc_write_u16(data, t->x0);
+        levelc_write_u16(data + 2, t->y0);
+        levelc_write_u16(data + 4, t->x1);
+        levelc_write_u16(data + 6, t->y1);
+        data[8] = t->action;
+        data[9] = t->param;
+        levelc_write_u16(data + 10, t->x);
+        levelc_write_u16(data + 12, t->y);
+        data[14] = t->kills;
+    }
+
+    uint8_t *offsets = out->data + out->index;
+    uint8_t *refs = offsets + (num_chunks + 1) * 2;
+    uint16_t ref = 0;
+    for (uint32_t chunk = 0; chunk < num_chunks; chunk++)
+    {
+        uint16_t chunk_x = chunk % chunks_x;
+        uint16_t chunk_y = chunk / chunks_x;
+
+        levelc_write_u16(offsets + chunk * 2, ref);
+        for (uint16_t i = 0; i < src->num_triggers; i++)
+        {
+            const LevelTrigger *t = &src->trigger[i];
+            if (((t->x0 >> LEVEL_CHUNK_BASE) <= chunk_x) &&
+                ((t->x1 >> LEVEL_CHUNK_BASE) >= chunk_x) &&
+                ((t->y0 >> LEVEL_CHUNK_BASE) <= chunk_y) &&
+                ((t->y1 >> LEVEL_CHUNK_BASE) >= chunk_y))
+                levelc_write_u16(refs + 2 * ref++, i);
+        }
+    }
+    levelc_write_u16(offsets + num_chunks * 2, ref);
+
+    levelc_compute_pvs(src, out->data + out->pvs);
+
+    return true;
+}
+
+/**
+ * @brief LEVELC compute the potentially visible set of every cell.
+ *
+ * @param src Parsed level
+ * @param pvs PVS section to be filled
+ */
+void levelc_compute_pvs(const LevelSource *src, uint8_t *pvs)
+{
+    int32_t cells_x = (src->width + LEVELC_CELL_SIZE - 1) >> LEVEL_PVS_BASE;
+    int32_t cells_y = (src->height + LEVELC_CELL_SIZE - 1) >> LEVEL_PVS_BASE;
+
+    for (int32_t y0 = 0; y0 < cells_y; y0++)
+    {
+        for (int32_t x0 = 0; x0 < cells_x; x0++)
+        {
+            uint8_t *cell = pvs + (y0 * cells_x + x0) * LEVEL_PVS_BYTES;
+
+            for (int32_t dy = -LEVEL_PVS_RADIUS; dy <= LEVEL_PVS_RADIUS; dy++)
+            {
+                for (int32_t dx = -LEVEL_PVS_RADIUS; dx <= LEVEL_PVS_RADIUS;
+                     dx++)
+                {
+                    int32_t x1 = x0 + dx;
+                    int32_t y1 = y0 + dy;
+
+                    // Visibility is symmetric, reuse the mirrored result
+                    bool visible;
+                    if ((y1 < y0) || ((y1 == y0) && (x1 < x0)))
+                    {
+                        if ((x1 < 0) || (y1 < 0) || (x1 >= cells_x))
+                            continue;
+
+                        uint8_t *other = pvs + (y1 * cells_x + x1) *
+                                                   LEVEL_PVS_BYTES;
+                        uint8_t bit = (LEVEL_PVS_RADIUS - dy) * LEVEL_PVS_SIZE +
+                                      (LEVEL_PVS_RADIUS - dx);
+                        visible = other[bit / 8] & (0x80 >> (bit % 8));
+                    }
+                    else
+                    {
+                        visible = levelc_is_cell_visible(src, x0, y0, x1, y1);
+                    }
+
+                    if (visible)
+                    {
+                        uint8_t bit = (dy + LEVEL_PVS_RADIUS) * LEVEL_PVS_SIZE +
+                                      (dx + LEVEL_PVS_RADIUS);
+                        cell[bit / 8] |= 0x80 >> (bit % 8);
+                    }
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief LEVELC check if any floor tile of a cell sees any floor tile of
+ * another cell.
+ *
+ * @param src     Parsed level
+ * @param cell_x0 First cell X coordinate
+ * @param cell_y0 First cell Y coordinate
+ * @param cell_x1 Second cell X coordinate
+ * @param cell_y1 Second cell Y coordinate
+ * @return bool Cells are visible from each other
+ */
+bool levelc_is_cell_visible(const LevelSource *src, int32_t cell_x0,
+                            int32_t cell_y0, int32_t cell_x1, int32_t cell_y1)
+{
+    // Tile center, as used by line of sight rays, and corners
+    static const float sample[LEVELC_PVS_SAMPLES][2] = {
+        {0.5f, 0.5f},
+        {LEVELC_PVS_INSET, LEVELC_PVS_INSET},
+        {1.0f - LEVELC_PVS_INSET, LEVELC_PVS_INSET},
+        {LEVELC_PVS_INSET, 1.0f - LEVELC_PVS_INSET},
+        {1.0f - LEVELC_PVS_INSET, 1.0f - LEVELC_PVS_INSET}};
+
+    for (int32_t i = 0; i < LEVELC_CELL_SIZE * LEVELC_CELL_SIZE; i++)
+    {
+        int32_t x0 = (cell_x0 << LEVEL_PVS_BASE) + i % LEVELC_CELL_SIZE;
+        int32_t y0 = (cell_y0 << LEVEL_PVS_BASE) + i / LEVELC_CELL_SIZE;
+        if (!levelc_is_floor(src, x0, y0))
+            continue;
+
+        for (int32_t j = 0; j < LEVELC_CELL_SIZE * LEVELC_CELL_SIZE; j++)
+        {
+            int32_t x1 = (cell_x1 << LEVEL_PVS_BASE) + j % LEVELC_CELL_SIZE;
+            int32_t y1 = (cell_y1 << LEVEL_PVS_BASE) + j / LEVELC_CELL_SIZE;
+            if (!levelc_is_floor(src, x1, y1))
+                continue;
+
+            for (uint8_t a = 0; a < LEVELC_PVS_SAMPLES; a++)
+            {
+                for (uint8_t b = 0; b < LEVELC_PVS_SAMPLES; b++)
+                {
+                    if (levelc_trace_ray(src, x0 + sample[a][0],
+                                         y0 + sample[a][1], x1 + sample[b][0],
+                                         y1 + sample[b][1]))
+                        return true;
+                }
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief LEVELC trace a ray between two points, same DDA as the raycaster.
+ *
+ * @param src Parsed level
+ * @param x0  Start X coordinate
+ * @param y0  Start Y coordinate
+ * @param x1  End X coordinate
+ * @param y1  End Y coordinate
+ * @return bool No solid tile has been crossed
+ */
+bool levelc_trace_ray(const LevelSource *src, float x0, float y0, float x1,
+                      float y1)
+{
+    float ray_x = x1 - x0;
+    float ray_y = y1 - y0;
+    int32_t map_x = x0;
+    int32_t map_y = y0;
+    int32_t end_x = x1;
+    int32_t end_y = y1;
+    float delta_x = (ray_x == 0.0f) ? INFINITY : fabsf(1.0f / ray_x);
+    float delta_y = (ray_y == 0.0f) ? INFINITY : fabsf(1.0f / ray_y);
+    int8_t step_x = (ray_x < 0.0f) ? -1 : 1;
+    int8_t step_y = (ray_y < 0.0f) ? -1 : 1;
+    float side_x = ((ray_x < 0.0f) ? (x0 - map_x) : (map_x + 1.0f - x0)) *
+                   delta_x;
+    float side_y = ((ray_y < 0.0f) ? (y0 - map_y) : (map_y + 1.0f - y0)) *
+                   delta_y;
+
+    // Each step crosses one tile edge towards the end tile
+    int32_t steps = abs(end_x - map_x) + abs(end_y - map_y);
+    for (int32_t i = 1; i < steps; i++)
+    {
+        if (side_x < side_y)
+        {
+            side_x += delta_x;
+            map_x += step_x;
+        }
+        else
+        {
+            side_y += delta_y;
+            map_y += step_y;
+        }
+
+        if (!levelc_is_floor(src, map_x, map_y))
+            return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief LEVELC check if a tile lets rays through, tiles out of the map
+ * don't.
+ *
+ * @param src Parsed level
+ * @param x   X coordinate
+ * @param y   Y coordinate
+ * @return bool Tile is not solid
+ */
+bool levelc_is_floor(const LevelSource *src, int32_t x, int32_t y)
+{
+    if ((x < 0) || (x >= src->width) || (y < 0) || (y >= src->height))
+        return false;
+
+    return !levelc_is_solid(
+        src->tiles[(size_t)(src->height - 1 - y) * src->width + x]);
+}
+
+/**
+ * @brief LEVELC parse a trigger source line.
+ *
+ * @param line    Source line
+ * @param trigger Parsed trigger
+ * @return bool Line is a valid trigger
+ */
+bool levelc_parse_trigger(const char *line, LevelTrigger *trigger)
+{
+    static const char *actions[] = {"spawn", "teleport", "boss", "exit"};
+    char action[16];
+    unsigned x0, y0, x1, y1, param;
+    int x, y;
+    unsigned kills = 0;
+
+    int fields = sscanf(line, "trigger %u %u %u %u %15s %u %d %d %u", &x0, &y0,
+                        &x1, &y1, action, &param, &x, &y, &kills);
+    if ((fields < 8) || (param > UINT8_MAX) || (kills > UINT8_MAX))
+        return false;
+
+    for (uint8_t i = 0; i < sizeof(actions) / sizeof(actions[0]); i++)
+    {
+        if (strcmp(action, actions[i]) != 0)
+            continue;
+
+        // Negative coordinates are kept as two's complement offsets
+        *trigger = (LevelTrigger){
+            .x0 = x0, .y0 = y0, .x1 = x1, .y1 = y1,
+            .action = i, .param = param,
+            .x = (uint16_t)x, .y = (uint16_t)y,
+            .kills = kills};
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief LEVELC compress the chunk major map of a compiled level, moving the
+ * following sections.
+ *
+ * @param out Compiled level
+ */
+void levelc_compress(LevelOutput *out)
+{
+    uint32_t num_chunks = (out->spawns - out->map) / LEVEL_CHUNK_BYTES;
+    uint32_t table_size = (num_chunks + 1) * 4;
+
+    // Worst case adds one control byte every 128 bytes
+    uint32_t max_size = out->size + table_size + num_chunks;
+    uint8_t *data = calloc(max_size, 1);
+
+    memcpy(data, out->data, LEVEL_HEADER_SIZE);
+    data[5] |= LEVEL_FLAG_RLE;
+
+    uint8_t *table = data + out->map;
+    uint32_t offset = 0;
+    for (uint32_t i = 0; i < num_chunks; i++)
+    {
+        levelc_write_u32(table + i * 4, offset);
+        offset += levelc_compress_chunk(
+            out->data + out->map + i * LEVEL_CHUNK_BYTES,
+            table + table_size + offset);
+    }
+    levelc_write_u32(table + num_chunks * 4, offset);
+
+    uint32_t spawns = out->map + table_size + offset;
+    uint32_t moved = spawns - out->spawns;
+    memcpy(data + spawns, out->data + out->spawns, out->size - out->spawns);
+
+    free(out->data);
+    out->data = data;
+    out->spawns += moved;
+    out->triggers += moved;
+    out->solid += moved;
+    out->index += moved;
+    out->pvs += moved;
+    out->size += moved;
+}
+
+/**
+ * @brief LEVELC compress a map chunk with run length encoding, control bytes
+ * are followed by a byte repeated (N & 0x7f) + 1 times if N & 0x80, by
+ * N + 1 literal bytes otherwise.
+ *
+ * @param map  Chunk map, LEVEL_CHUNK_BYTES long
+ * @param data Compressed chunk
+ * @return uint8_t Compressed size in bytes
+ */
+uint8_t levelc_compress_chunk(const uint8_t *map, uint8_t *data)
+{
+    uint8_t size = 0;
+    uint8_t i = 0;
+
+    while (i < LEVEL_CHUNK_BYTES)
+    {
+        uint8_t run = 1;
+        while ((i + run < LEVEL_CHUNK_BYTES) && (map[i + run] == map[i]))
+            run++;
+
+        // Runs shorter than 3 bytes are cheaper as literals
+        if (run >= 3)
+        {
+            data[size++] = 0x80 | (run - 1);
+            data[size++] = map[i];
+            i += run;
+            continue;
+        }
+
+        uint8_t literal = 0;
+        while ((i + literal < LEVEL_CHUNK_BYTES) &&
+               !((i + literal + 2 < LEVEL_CHUNK_BYTES) &&
+                 (map[i + literal] == map[i + literal + 1]) &&
+                 (map[i + literal] == map[i + literal + 2])))
+            literal++;
+
+        data[size++] = literal - 1;
+        memcpy(data + size, map + i, literal);
+        size += literal;
+        i += literal;
+    }
+
+    return size;
+}
+
+/**
+ * @brief LEVELC check if an entity type is listed in the spawn table.
+ *
+ * @param type Entity type
+ * @return bool Entity is spawned
+ */
+bool levelc_is_spawn(uint8_t type)
+{
+    return (type == E_PLAYER) || (type == E_ENEMY) || (type == E_MEDKIT) ||
+           (type == E_AMMO);
+}
+
+/**
+ * @brief LEVELC check if an entity type blocks rays, same rule as the
+ * raycaster.
+ *
+ * @param type Entity type
+ * @return bool Entity is solid
+ */
+bool levelc_is_solid(uint8_t type)
+{
+    return (type == E_WALL) || (type == E_DOOR) || (type == E_DOOR2) ||
+           (type == E_DOOR3) || (type == E_COLL);
+}
+
+/**
+ * @brief LEVELC write little endian 16 bit value.
+ *
+ * @param data  Data pointer
+ * @param value Value
+ */
+void levelc_write_u16(uint8_t *data, uint16_t value)
+{
+    data[0] = value & 0xff;
+    data[1] = value >> 8;
+}
+
+/**
+ * @brief LEVELC write little endian 32 bit value.
+ *
+ * @param data  Data pointer
+ * @param value Value
+ */
+void levelc_write_u32(uint8_t *data, uint32_t value)
+{
+    levelc_write_u16(data, value & 0xffff);
+    levelc_write_u16(data + 2, value >> 16);
+}
+
+/**
+ * @brief LEVELC write compiled level as a binary file.
+ *
+ * @param path Output path
+ * @param out  Compiled level
+ * @return bool File was written
+ */
+bool levelc_write_binary(const char *path, const LevelOutput *out)
+{
+    // Written to a temporary file then renamed, so a running game that has
+    // the level mapped never sees a truncated file
+    char temp[4096];
+    snprintf(temp, sizeof(temp), "%s.tmp", path);
+
+    FILE *file = fopen(temp, "wb");
+    if (file == NULL)
+    {
+        perror(temp);
+        return false;
+    }
+
+    bool written = fwrite(out->data, 1, out->size, file) == out->size;
+    written &= fclose(file) == 0;
+
+    if (!written || (rename(temp, path) != 0))
+    {
+        perror(path);
+        remove(temp);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief LEVELC write compiled level as a C array named after its source.
+ *
+ * @param file Output file
+ * @param path Source path
+ * @param out  Compiled level
+ */
+void levelc_write_array(FILE *file, const char *path, const LevelOutput *out)
+{
+    const char *name = strrchr(path, '/');
+    name = (name != NULL) ? name + 1 : path;
+    int length = strcspn(name, ".");
+
+    fprintf(file, "\nstatic const uint8_t level_%.*s[] = {", length, name);
+    levelc_write_sections(file, "Header", out, true);
+    fprintf(file, "};\n");
+}
+
+/**
+ * @brief LEVELC write episode pack as a C array named after its manifest.
+ *
+ * @param file    Output file
+ * @param path    Manifest path
+ * @param episode Parsed episode
+ * @param level   Compiled levels, in episode order
+ * @param out     Episode pack
+ */
+void levelc_write_episode_array(FILE *file, const char *path,
+                                const EpisodeSource *episode,
+                                const LevelOutput *level,
+                                const LevelOutput *out)
+{
+    const char *name = strrchr(path, '/');
+    name = (name != NULL) ? name + 1 : path;
+    int length = strcspn(name, ".");
+
+    fprintf(file, "\nstatic const uint8_t episode_%.*s[] = {", length, name);
+    levelc_write_bytes(file, "Episode header", out->data,
+                       EPISODE_HEADER_SIZE, true);
+    levelc_write_bytes(file, "Episode index", out->data + EPISODE_HEADER_SIZE,
+                       episode->num_levels * EPISODE_INDEX_SIZE, false);
+
+    for (uint8_t i = 0; i < episode->num_levels; i++)
+    {
+        char header[32];
+        snprintf(header, sizeof(header), "Level %s header",
+                 episode->level[i].name);
+        levelc_write_sections(file, header, &level[i], false);
+    }
+    fprintf(file, "};\n");
+}
+
+/**
+ * @brief LEVELC write the sections of a compiled level as C array bytes.
+ *
+ * @param file   Output file
+ * @param header Name of the header section
+ * @param out    Compiled level
+ * @param first  First section of the array
+ */
+void levelc_write_sections(FILE *file, const char *header,
+                           const LevelOutput *out, bool first)
+{
+    levelc_write_bytes(file, header, out->data, LEVEL_HEADER_SIZE, first);
+    levelc_write_bytes(file, "Map", out->data + out->map,
+                       out->spawns - out->map, false);
+    levelc_write_bytes(file, "Spawns", out->data + out->spawns,
+                       out->triggers - out->spawns, false);
+    levelc_write_bytes(file, "Triggers", out->data + out->triggers,
+                       out->solid - out->triggers, false);
+    levelc_write_bytes(file, "Solid", out->data + out->solid,
+                       out->index - out->solid, false);
+    levelc_write_bytes(file, "Trigger index", out->data + out->index,
+                       out->pvs - out->index, false);
+    levelc_write_bytes(file, "PVS", out->data + out->pvs,
+                       out->size - out->pvs, false);
+}
+
+/**
+ * @brief LEVELC write a level section as C array bytes.
+ *
+ * @param file    Output file
+ * @param section Section name
+ * @param data    Section data
+ * @param size    Section size in bytes
+ * @param first   First section of the array
+ */
+void levelc_write_bytes(FILE *file, const char *section, const uint8_t *data,
+                        uint32_t size, bool first)
+{
+    if (size == 0)
+        return;
+
+    // Separate from the previous section, if any
+    if (!first)
+        fprintf(file, ",");
+
+    fprintf(file, "\n    /* %s */", section);
+    for (uint32_t i = 0; i < size; i++)
+    {
+        if (i % LEVELC_BYTES_LINE == 0)
+            fprintf(file, "\n    ");
+        else
+            fprintf(file, " ");
+
+        fprintf(file, "0x%02X%s", data[i], (i + 1 < size) ? "," : "");
+    }
+}
+
+/* -------------------------------------------------------------------------- */
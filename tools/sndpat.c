@@ -0,0 +1,329 @@
+/**
+ * @brief SNDPAT host sound pattern converter.
+ *
+ * Converts every sound of sound.h, stored as one inverse frequency byte per
+ * step, into the pattern format described in sound.h: runs of the same byte
+ * become a single note, then the longest saving group of up to
+ * SOUND_PATTERN_MAX_NOTES notes played again right after is replaced by a
+ * repeat command. Each pattern is expanded back and checked against its
+ * sound before being written.
+ *
+ * Patterns are written as name_pat arrays of NAME_PAT_SIZE bytes.
+ *
+ * Usage:
+ *   sndpat -o <output.h>
+ */
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Patterns are generated here, and may not exist yet
+#define SOUND_NO_DATA
+#include "sound.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+#define SNDPAT_MAX_NOTES  (UINT8_MAX + 1)
+#define SNDPAT_MAX_SIZE   (SNDPAT_MAX_NOTES * 2 + 2)
+#define SNDPAT_BYTES_LINE 12
+
+#define SNDPAT_SOUND(name, NAME) {#name, #NAME, name##_snd, NAME##_SND_LEN},
+
+/* Data types --------------------------------------------------------------- */
+
+typedef struct
+{
+    const char *name;
+    const char *upper;
+    const uint8_t *snd;
+    uint8_t len;
+} SndpatSound;
+
+typedef struct
+{
+    uint8_t value;
+    uint8_t ticks;
+} SndpatNote;
+
+/* Function prototypes ------------------------------------------------------ */
+
+static uint16_t sndpat_convert(const uint8_t *snd, uint8_t len,
+                               uint8_t *pattern);
+static uint16_t sndpat_count_repeats(const SndpatNote *note, uint16_t count,
+                                     uint16_t first, uint8_t size);
+static bool sndpat_check(const uint8_t *pattern, const uint8_t *snd,
+                         uint8_t len);
+static void sndpat_write_array(FILE *file, const SndpatSound *sound,
+                               const uint8_t *pattern, uint16_t size);
+
+/* Global variables --------------------------------------------------------- */
+
+static const SndpatSound sndpat_sounds[] = {SOUND_LIST(SNDPAT_SOUND)};
+
+#define SNDPAT_NUM_SOUNDS (sizeof(sndpat_sounds) / sizeof(sndpat_sounds[0]))
+
+/* Function definitions ----------------------------------------------------- */
+
+int main(int argc, char *argv[])
+{
+    if ((argc != 3) || (strcmp(argv[1], "-o") != 0))
+    {
+        fprintf(stderr, "usage: sndpat -o <output.h>\n");
+        return EXIT_FAILURE;
+    }
+
+    const char *output = argv[2];
+    FILE *file = fopen(output, "w");
+    if (file == NULL)
+    {
+        perror(output);
+        return EXIT_FAILURE;
+    }
+
+    fprintf(file,
+            "/* Generated by tools/sndpat.c from inc/sound.h, do not edit */\n"
+            "\n"
+            "/* Header guard "
+            "------------------------------------------------------------- */\n"
+            "\n"
+            "#ifndef SOUND_DATA_H\n"
+            "#define SOUND_DATA_H\n"
+            "\n"
+            "/* Includes "
+            "----------------------------------------------------------------- */\n"
+            "\n"
+            "#include <stdint.h>\n");
+
+    uint32_t total_len = 0;
+    uint32_t total_size = 0;
+    bool valid = true;
+
+    for (uint8_t i = 0; (i < SNDPAT_NUM_SOUNDS) && valid; i++)
+    {
+        const SndpatSound *sound = &sndpat_sounds[i];
+        uint8_t pattern[SNDPAT_MAX_SIZE];
+
+        uint16_t size = sndpat_convert(sound->snd, sound->len, pattern);
+        valid = sndpat_check(pattern, sound->snd, sound->len);
+        if (!valid)
+        {
+            fprintf(stderr, "%s: pattern does not match the sound\n",
+                    sound->name);
+            break;
+        }
+
+        sndpat_write_array(file, sound, pattern, size);
+        printf("%s: %u steps, %u bytes\n", sound->name, sound->len, size);
+
+        total_len += sound->len;
+        total_size += size;
+    }
+
+    fprintf(file,
+            "\n"
+            "#endif /* SOUND_DATA_H */\n"
+            "\n"
+            "/* "
+            "-------------------------------------------------------------------"
+            "------- */\n");
+
+    if (fclose(file) != 0)
+    {
+        perror(output);
+        valid = false;
+    }
+
+    if (!valid)
+    {
+        remove(output);
+        return EXIT_FAILURE;
+    }
+
+    printf("%u sounds, %u bytes to %u bytes\n", (unsigned)SNDPAT_NUM_SOUNDS,
+           total_len, total_size);
+
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief SNDPAT convert a sound into a pattern.
+ *
+ * @param snd     Sound byte array
+ * @param len     Byte length of sound
+ * @param pattern Output pattern, SNDPAT_MAX_SIZE long
+ * @return uint16_t Pattern size
+ */
+uint16_t sndpat_convert(const uint8_t *snd, uint8_t len, uint8_t *pattern)
+{
+    SndpatNote note[SNDPAT_MAX_NOTES];
+    uint16_t count = 0;
+    uint16_t size = 0;
+
+    // Runs of the same value, up to the longest note
+    for (uint8_t i = 0; i < len; i++)
+    {
+        if ((count > 0) && (note[count - 1].value == snd[i]) &&
+            (note[count - 1].ticks < UINT8_MAX))
+            note[count - 1].ticks++;
+        else
+            note[count++] = (SndpatNote){snd[i], 1};
+    }
+
+    for (uint16_t i = 0; i < count;)
+    {
+        uint8_t best_notes = 1;
+        uint16_t best_times = 0;
+        int32_t best_saved = 0;
+
+        // Bytes saved by a repeat command replacing the next groups
+        for (uint8_t notes = 1;
+             (notes <= SOUND_PATTERN_MAX_NOTES) && (i + notes <= count);
+             notes++)
+        {
+            uint16_t times = sndpat_count_repeats(note, count, i, notes);
+            int32_t saved = (int32_t)times * notes * 2 - 2;
+
+            if (saved > best_saved)
+            {
+                best_notes = notes;
+                best_times = times;
+                best_saved = saved;
+            }
+        }
+
+        for (uint8_t j = 0; j < best_notes; j++)
+        {
+            pattern[size++] = note[i + j].value;
+            pattern[size++] = note[i + j].ticks;
+        }
+
+        if (best_times > 0)
+        {
+            uint8_t command[] = {
+                SOUND_PATTERN_REPEAT(best_notes, best_times)};
+
+            memcpy(&pattern[size], command, sizeof(command));
+            size += sizeof(command);
+        }
+
+        i += best_notes * (best_times + 1);
+    }
+
+    uint8_t end[] = {SOUND_PATTERN_END};
+    memcpy(&pattern[size], end, sizeof(end));
+
+    return size + sizeof(end);
+}
+
+/**
+ * @brief SNDPAT count how many times a group of notes is played again right
+ * after itself.
+ *
+ * @param note  Notes of the sound
+ * @param count Number of notes
+ * @param first First note of the group
+ * @param size  Number of notes of the group
+ * @return uint16_t Number of repetitions, up to SOUND_PATTERN_MAX_TIMES
+ */
+uint16_t sndpat_count_repeats(const SndpatNote *note, uint16_t count,
+                              uint16_t first, uint8_t size)
+{
+    uint16_t times = 0;
+    uint16_t next = first + size;
+
+    while ((times < SOUND_PATTERN_MAX_TIMES) && (next + size <= count) &&
+           (memcmp(&note[first], &note[next], size * sizeof(SndpatNote)) == 0))
+    {
+        times++;
+        next += size;
+    }
+
+    return times;
+}
+
+/**
+ * @brief SNDPAT expand a pattern back into steps and compare it to a sound.
+ *
+ * @param pattern Pattern byte array
+ * @param snd     Sound byte array
+ * @param len     Byte length of sound
+ * @return bool Pattern plays the sound
+ */
+bool sndpat_check(const uint8_t *pattern, const uint8_t *snd, uint8_t len)
+{
+    SndpatNote note[SNDPAT_MAX_NOTES * (SOUND_PATTERN_MAX_TIMES + 1)];
+    uint32_t count = 0;
+
+    for (uint16_t pos = 0; (pattern[pos] != 0x00) || (pattern[pos + 1] != 0);
+         pos += 2)
+    {
+        uint8_t value = pattern[pos];
+        uint8_t ticks = pattern[pos + 1];
+
+        if (ticks != 0)
+        {
+            note[count++] = (SndpatNote){value, ticks};
+            continue;
+        }
+
+        // Copy the group of notes just before
+        uint8_t notes = value >> 4;
+        uint8_t times = value & 0x0f;
+        if ((notes == 0) || (notes > count))
+            return false;
+
+        for (uint8_t i = 0; i < times; i++)
+        {
+            memcpy(&note[count], &note[count - notes],
+                   notes * sizeof(SndpatNote));
+            count += notes;
+        }
+    }
+
+    uint16_t idx = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        for (uint8_t j = 0; j < note[i].ticks; j++)
+        {
+            if ((idx >= len) || (snd[idx++] != note[i].value))
+                return false;
+        }
+    }
+
+    return idx == len;
+}
+
+/**
+ * @brief SNDPAT write a pattern as a C array.
+ *
+ * @param file    Output file
+ * @param sound   Converted sound
+ * @param pattern Pattern byte array
+ * @param size    Pattern size
+ */
+void sndpat_write_array(FILE *file, const SndpatSound *sound,
+                        const uint8_t *pattern, uint16_t size)
+{
+    fprintf(file,
+            "\n"
+            "#define %s_PAT_SIZE %u\n"
+            "static const uint8_t %s_pat[%s_PAT_SIZE] = {",
+            sound->upper, size, sound->name, sound->upper);
+
+    for (uint16_t i = 0; i < size; i++)
+    {
+        if (i % SNDPAT_BYTES_LINE == 0)
+            fprintf(file, "\n    ");
+        else
+            fprintf(file, " ");
+
+        fprintf(file, "0x%02X%s", pattern[i], (i + 1 < size) ? "," : "};\n");
+    }
+}
+
+/* -------------------------------------------------------------------------- */
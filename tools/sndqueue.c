@@ -0,0 +1,266 @@
+/**
+ * @brief SNDQUEUE host stress test of the sound command queue.
+ *
+ * One thread plays numbered commands with sound_play as fast as it can, as a
+ * game that never waits for the audio callback, while another thread renders
+ * audio blocks with sound_render as the platform audio callback does. Every
+ * command carries its sequence number in its sound, length and priority.
+ *
+ * sound.c is built with SOUND_QUEUE_TRACE, so its queue reports each command
+ * rejected on a full queue, and each command taken by sound_render. Rejected
+ * commands must be the ones being played, taken commands must come in order,
+ * and every command must be either rejected or taken exactly once, so a
+ * lost, duplicated, reordered or torn command is reported. Built with
+ * ThreadSanitizer by the stress target, which also reports any data race.
+ *
+ * Usage:
+ *   sndqueue [-n <commands>]
+ */
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <time.h>
+
+#include "sound.h"
+#include "utils.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+#define SNDQUEUE_COMMANDS 2000000
+#define SNDQUEUE_MAX      (1 << 24)
+
+/* Audio callback block */
+#define SNDQUEUE_RATE   44100
+#define SNDQUEUE_FRAMES 64
+
+/* Function prototypes ------------------------------------------------------ */
+
+static void *sndqueue_produce(void *arg);
+static void *sndqueue_consume(void *arg);
+static uint32_t sndqueue_number(const uint8_t *snd, uint8_t len,
+                                uint8_t priority);
+static double sndqueue_seconds(void);
+
+/* Global variables --------------------------------------------------------- */
+
+/* Sequence numbers are stored as sound = &sndqueue_sounds[n >> 16],
+ * priority = (n >> 8) & 0xff and length = n & 0xff, silent sounds long
+ * enough to be rendered from any of them */
+static const uint8_t sndqueue_sounds[2 * (UINT8_MAX + 1)];
+
+static uint32_t sndqueue_commands = SNDQUEUE_COMMANDS;
+static atomic_bool sndqueue_done;
+
+/* Producer state, the command being played and the rejected ones */
+static uint32_t sndqueue_playing = 0;
+static uint32_t sndqueue_rejects = 0;
+static bool *sndqueue_rejected;
+
+/* Consumer state, the last command taken and the taken ones */
+static uint32_t sndqueue_last = 0;
+static uint32_t sndqueue_takes = 0;
+static uint32_t sndqueue_renders = 0;
+static uint32_t sndqueue_max_take = 0;
+static bool *sndqueue_taken;
+
+/* Counted by both threads */
+static atomic_uint sndqueue_errors;
+
+/* Function definitions ----------------------------------------------------- */
+
+int main(int argc, char *argv[])
+{
+    if ((argc == 3) && (strcmp(argv[1], "-n") == 0))
+        sndqueue_commands = strtoul(argv[2], NULL, 10);
+    else if (argc != 1)
+        sndqueue_commands = 0;
+
+    if ((sndqueue_commands == 0) || (sndqueue_commands > SNDQUEUE_MAX))
+    {
+        fprintf(stderr, "usage: sndqueue [-n <commands>], at most %u\n",
+                SNDQUEUE_MAX);
+        return EXIT_FAILURE;
+    }
+
+    sndqueue_rejected = calloc(sndqueue_commands, sizeof(bool));
+    sndqueue_taken = calloc(sndqueue_commands, sizeof(bool));
+    if ((sndqueue_rejected == NULL) || (sndqueue_taken == NULL))
+    {
+        fprintf(stderr, "sndqueue: out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    pthread_t producer;
+    pthread_t consumer;
+
+    sound_init();
+
+    double start = sndqueue_seconds();
+    pthread_create(&consumer, NULL, sndqueue_consume, NULL);
+    pthread_create(&producer, NULL, sndqueue_produce, NULL);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    double time = sndqueue_seconds() - start;
+
+    // Every command is either rejected or taken, exactly once
+    uint32_t lost = 0;
+    for (uint32_t n = 0; n < sndqueue_commands; n++)
+    {
+        if (sndqueue_rejected[n] == sndqueue_taken[n])
+        {
+            if ((lost++ == 0) && (sndqueue_errors == 0))
+                fprintf(stderr, "command %u %s\n", n,
+                        sndqueue_taken[n] ? "taken after its rejection"
+                                          : "lost");
+        }
+    }
+
+    printf("%u commands in %.3f s, %u taken by %u renders of up to %u "
+           "commands, %u rejected on a full queue, %u lost, %u errors\n",
+           sndqueue_commands, time, sndqueue_takes, sndqueue_renders,
+           sndqueue_max_take, sndqueue_rejects, lost, sndqueue_errors);
+
+    free(sndqueue_rejected);
+    free(sndqueue_taken);
+
+    return ((lost == 0) && (sndqueue_errors == 0) && (sndqueue_takes > 0))
+               ? EXIT_SUCCESS
+               : EXIT_FAILURE;
+}
+
+/**
+ * @brief SNDQUEUE play every sequence number in order, without waiting for
+ * room in the queue.
+ *
+ * @param arg Unused
+ * @return void* Unused
+ */
+void *sndqueue_produce(void *arg)
+{
+    (void)arg;
+
+    for (uint32_t n = 0; n < sndqueue_commands; n++)
+    {
+        sndqueue_playing = n;
+        sound_play(&sndqueue_sounds[n >> 16], n & 0xff, (n >> 8) & 0xff,
+                   true);
+    }
+
+    atomic_store(&sndqueue_done, true);
+
+    return NULL;
+}
+
+/**
+ * @brief SNDQUEUE render audio blocks as the audio callback does, until the
+ * producer is done and its last commands are taken.
+ *
+ * @param arg Unused
+ * @return void* Unused
+ */
+void *sndqueue_consume(void *arg)
+{
+    (void)arg;
+    static int16_t buffer[SNDQUEUE_FRAMES];
+    bool done;
+
+    do
+    {
+        // Read before rendering, so the last render takes every command
+        done = atomic_load(&sndqueue_done);
+
+        uint32_t takes = sndqueue_takes;
+        sound_render(buffer, SNDQUEUE_FRAMES, SNDQUEUE_RATE);
+
+        sndqueue_renders++;
+        sndqueue_max_take = MAX(sndqueue_max_take, sndqueue_takes - takes);
+    } while (!done);
+
+    return NULL;
+}
+
+/**
+ * @brief SNDQUEUE check a command reported by the queue.
+ *
+ * @param snd      Sound byte array
+ * @param len      Byte length of sound
+ * @param priority Sound priority
+ * @param pattern  Sound is a pattern
+ * @param loop     Restart the pattern at its end
+ * @param queued   Command went through the queue, otherwise it was rejected
+ */
+void sound_queue_trace(const uint8_t *snd, uint8_t len, uint8_t priority,
+                       bool pattern, bool loop, bool queued)
+{
+    uint32_t n = sndqueue_number(snd, len, priority);
+    bool valid = !pattern && !loop && (n < sndqueue_commands);
+
+    if (!queued)
+    {
+        // Called by sound_play, in the producer thread
+        valid &= (n == sndqueue_playing);
+        if (valid)
+            sndqueue_rejected[n] = true;
+        else if (sndqueue_errors++ == 0)
+            fprintf(stderr, "command %u rejected while playing %u\n", n,
+                    sndqueue_playing);
+
+        sndqueue_rejects++;
+    }
+    else
+    {
+        // Called by sound_render, in the consumer thread
+        valid &= (sndqueue_takes == 0) || (n > sndqueue_last);
+        if (valid)
+            sndqueue_taken[n] = true;
+        else if (sndqueue_errors++ == 0)
+            fprintf(stderr, "command %u taken after %u\n", n, sndqueue_last);
+
+        sndqueue_last = n;
+        sndqueue_takes++;
+    }
+}
+
+/**
+ * @brief SNDQUEUE get the sequence number of a command.
+ *
+ * @param snd      Sound byte array
+ * @param len      Byte length of sound
+ * @param priority Sound priority
+ * @return uint32_t Sequence number
+ */
+uint32_t sndqueue_number(const uint8_t *snd, uint8_t len, uint8_t priority)
+{
+    return ((uint32_t)(snd - sndqueue_sounds) << 16) | (priority << 8) | len;
+}
+
+/**
+ * @brief SNDQUEUE get monotonic time.
+ *
+ * @return double Time in seconds
+ */
+double sndqueue_seconds(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief SNDQUEUE headless platform, commands are rendered without audio
+ * device.
+ *
+ */
+void platform_audio_play(void)
+{
+}
+
+/* -------------------------------------------------------------------------- */
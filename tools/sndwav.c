@@ -0,0 +1,329 @@
+/**
+ * @brief SNDWAV host offline sound renderer.
+ *
+ * Runs the sound pipeline of sound.c, sound_play then sound_render, against
+ * a virtual sample clock instead of an audio device, and writes every sound
+ * of sound.h as a 16-bit mono WAV file named after the sound. Rendering time
+ * is measured without file accesses and reported against real time.
+ *
+ * With -c, the rendered sounds are compared to the WAV files already in the
+ * directory instead, so golden files catch any change of the synthesizer.
+ *
+ * Usage, -r sets the sampling rate and -b the frames per sound_render call:
+ *   sndwav [-r <rate>] [-b <frames>] -o <directory>
+ *   sndwav [-r <rate>] [-b <frames>] -c <directory>
+ */
+
+/* Includes ----------------------------------------------------------------- */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "platform.h"
+#include "sound.h"
+#include "utils.h"
+
+/* Definitions -------------------------------------------------------------- */
+
+#define SNDWAV_RATE        44100
+#define SNDWAV_BLOCK       512
+#define SNDWAV_HEADER_SIZE 44
+#define SNDWAV_PATH_SIZE   4096
+
+/* Sounds are at most UINT8_MAX steps, each up to one block late to end */
+#define SNDWAV_MAX_FRAMES(rate, block) \
+    ((UINT8_MAX + 1) * ((rate) / SOUND_STEP_RATE + 1) + (block))
+
+#define SNDWAV_SOUND(name, NAME) \
+    {#name, name##_snd, NAME##_SND_LEN, NAME##_SND_PRIORITY},
+
+/* Data types --------------------------------------------------------------- */
+
+typedef struct
+{
+    const char *name;
+    const uint8_t *snd;
+    uint8_t len;
+    uint8_t priority;
+} SndwavSound;
+
+/* Function prototypes ------------------------------------------------------ */
+
+static uint32_t sndwav_render(const SndwavSound *sound, int16_t *samples,
+                              uint32_t rate, uint32_t block);
+static uint32_t sndwav_encode(const int16_t *samples, uint32_t frames,
+                              uint32_t rate, uint8_t *data);
+static bool sndwav_write(const char *path, const uint8_t *data, uint32_t size);
+static bool sndwav_compare(const char *path, const uint8_t *data,
+                           uint32_t size);
+static void sndwav_write_u16(uint8_t *data, uint16_t value);
+static void sndwav_write_u32(uint8_t *data, uint32_t value);
+static double sndwav_seconds(void);
+
+/* Global variables --------------------------------------------------------- */
+
+static const SndwavSound sndwav_sounds[] = {SOUND_LIST(SNDWAV_SOUND)};
+
+#define SNDWAV_NUM_SOUNDS (sizeof(sndwav_sounds) / sizeof(sndwav_sounds[0]))
+
+/* Function definitions ----------------------------------------------------- */
+
+int main(int argc, char *argv[])
+{
+    uint32_t rate = SNDWAV_RATE;
+    uint32_t block = SNDWAV_BLOCK;
+    const char *directory = NULL;
+    bool compare = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((strcmp(argv[i], "-r") == 0) && (i + 1 < argc))
+        {
+            rate = strtoul(argv[++i], NULL, 10);
+        }
+        else if ((strcmp(argv[i], "-b") == 0) && (i + 1 < argc))
+        {
+            block = strtoul(argv[++i], NULL, 10);
+        }
+        else if ((strcmp(argv[i], "-o") == 0) && (i + 1 < argc))
+        {
+            directory = argv[++i];
+            compare = false;
+        }
+        else if ((strcmp(argv[i], "-c") == 0) && (i + 1 < argc))
+        {
+            directory = argv[++i];
+            compare = true;
+        }
+        else
+        {
+            directory = NULL;
+            break;
+        }
+    }
+
+    if ((directory == NULL) || (rate < SOUND_STEP_RATE) || (block == 0))
+    {
+        fprintf(stderr,
+                "usage: sndwav [-r <rate>] [-b <frames>] -o <directory>\n"
+                "       sndwav [-r <rate>] [-b <frames>] -c <directory>\n");
+        return EXIT_FAILURE;
+    }
+
+    uint32_t max_frames = SNDWAV_MAX_FRAMES(rate, block);
+    int16_t *samples = malloc(max_frames * sizeof(int16_t));
+    uint8_t *data = malloc(SNDWAV_HEADER_SIZE + max_frames * sizeof(int16_t));
+    if ((samples == NULL) || (data == NULL))
+    {
+        fprintf(stderr, "sndwav: out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    uint64_t total_frames = 0;
+    double total_time = 0.0;
+    uint8_t failed = 0;
+
+    for (uint8_t i = 0; i < SNDWAV_NUM_SOUNDS; i++)
+    {
+        const SndwavSound *sound = &sndwav_sounds[i];
+        char path[SNDWAV_PATH_SIZE];
+
+        // Only the pipeline is timed, not the file accesses
+        double start = sndwav_seconds();
+        uint32_t frames = sndwav_render(sound, samples, rate, block);
+        total_time += sndwav_seconds() - start;
+        total_frames += frames;
+
+        uint32_t size = sndwav_encode(samples, frames, rate, data);
+        snprintf(path, sizeof(path), "%s/%s.wav", directory, sound->name);
+
+        bool valid = compare ? sndwav_compare(path, data, size)
+                             : sndwav_write(path, data, size);
+        if (!valid)
+            failed++;
+    }
+
+    double audio_time = (double)total_frames / rate;
+    printf("%u sounds, %llu samples, %.2f s of audio rendered in %.3f ms, "
+           "%.0fx real time, %.1f Msamples/s\n",
+           (unsigned)SNDWAV_NUM_SOUNDS, (unsigned long long)total_frames,
+           audio_time, total_time * 1000.0, audio_time / total_time,
+           total_frames / total_time / 1e6);
+
+    if (compare)
+        printf("%u sounds differ from %s\n", failed, directory);
+
+    free(samples);
+    free(data);
+
+    return (failed == 0) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief SNDWAV play a sound from silence and render it until it ends.
+ *
+ * @param sound   Sound to render
+ * @param samples Output samples, SNDWAV_MAX_FRAMES long
+ * @param rate    Sampling rate in Hz
+ * @param block   Frames per sound_render call
+ * @return uint32_t Number of samples rendered
+ */
+uint32_t sndwav_render(const SndwavSound *sound, int16_t *samples,
+                       uint32_t rate, uint32_t block)
+{
+    uint32_t frames = 0;
+
+    sound_init();
+    sound_play(sound->snd, sound->len, sound->priority, true);
+
+    // The last block is only rendered up to the end of the sound
+    while (sound_render(&samples[frames], block, rate))
+        frames += block;
+
+    uint32_t end = (sound->len * rate + SOUND_STEP_RATE - 1) / SOUND_STEP_RATE;
+
+    return MIN(end, frames + block);
+}
+
+/**
+ * @brief SNDWAV encode samples into a 16-bit mono PCM WAV file.
+ *
+ * @param samples Signed 16-bit mono samples
+ * @param frames  Number of samples
+ * @param rate    Sampling rate in Hz
+ * @param data    Output file data
+ * @return uint32_t File size
+ */
+uint32_t sndwav_encode(const int16_t *samples, uint32_t frames, uint32_t rate,
+                       uint8_t *data)
+{
+    uint32_t size = frames * sizeof(int16_t);
+
+    memcpy(&data[0], "RIFF", 4);
+    sndwav_write_u32(&data[4], SNDWAV_HEADER_SIZE - 8 + size);
+    memcpy(&data[8], "WAVEfmt ", 8);
+    sndwav_write_u32(&data[16], 16);
+    sndwav_write_u16(&data[20], 1);
+    sndwav_write_u16(&data[22], 1);
+    sndwav_write_u32(&data[24], rate);
+    sndwav_write_u32(&data[28], rate * sizeof(int16_t));
+    sndwav_write_u16(&data[32], sizeof(int16_t));
+    sndwav_write_u16(&data[34], 16);
+    memcpy(&data[36], "data", 4);
+    sndwav_write_u32(&data[40], size);
+
+    for (uint32_t i = 0; i < frames; i++)
+        sndwav_write_u16(&data[SNDWAV_HEADER_SIZE + i * 2],
+                         (uint16_t)samples[i]);
+
+    return SNDWAV_HEADER_SIZE + size;
+}
+
+/**
+ * @brief SNDWAV write file data.
+ *
+ * @param path File path
+ * @param data File data
+ * @param size File size
+ * @return bool File written
+ */
+bool sndwav_write(const char *path, const uint8_t *data, uint32_t size)
+{
+    FILE *file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        perror(path);
+        return false;
+    }
+
+    bool written = fwrite(data, 1, size, file) == size;
+    written &= fclose(file) == 0;
+
+    if (!written)
+        perror(path);
+
+    return written;
+}
+
+/**
+ * @brief SNDWAV compare file data to a golden file.
+ *
+ * @param path File path
+ * @param data File data
+ * @param size File size
+ * @return bool Golden file is identical
+ */
+bool sndwav_compare(const char *path, const uint8_t *data, uint32_t size)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        perror(path);
+        return false;
+    }
+
+    // Read one more byte to detect a longer golden file
+    uint8_t *golden = malloc(size + 1);
+    bool equal = (golden != NULL) &&
+                 (fread(golden, 1, size + 1, file) == size) &&
+                 (memcmp(golden, data, size) == 0);
+
+    fclose(file);
+    free(golden);
+
+    if (!equal)
+        fprintf(stderr, "%s: differs\n", path);
+
+    return equal;
+}
+
+/**
+ * @brief SNDWAV write 16-bit little endian value.
+ *
+ * @param data  Output data
+ * @param value Value to write
+ */
+void sndwav_write_u16(uint8_t *data, uint16_t value)
+{
+    data[0] = value & 0xff;
+    data[1] = value >> 8;
+}
+
+/**
+ * @brief SNDWAV write 32-bit little endian value.
+ *
+ * @param data  Output data
+ * @param value Value to write
+ */
+void sndwav_write_u32(uint8_t *data, uint32_t value)
+{
+    sndwav_write_u16(&data[0], value & 0xffff);
+    sndwav_write_u16(&data[2], value >> 16);
+}
+
+/**
+ * @brief SNDWAV get monotonic time.
+ *
+ * @return double Time in seconds
+ */
+double sndwav_seconds(void)
+{
+    struct timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+
+    return time.tv_sec + time.tv_nsec / 1e9;
+}
+
+/**
+ * @brief SNDWAV headless platform, sounds are rendered without audio device.
+ *
+ */
+void platform_audio_play(void)
+{
+}
+
+/* -------------------------------------------------------------------------- */